@@ -20,6 +20,7 @@
 
 #include "cpu_backend.hpp"
 #include "contrib/mlir/backend/pass/affine_lowerer.hpp"
+#include "contrib/mlir/backend/pass/parallel_loop_outliner.hpp"
 #include "contrib/mlir/utils.hpp"
 #include "ngraph/check.hpp"
 #include "ngraph/env_util.hpp"
@@ -34,6 +35,7 @@
 #include <mlir/Conversion/SCFToStandard/SCFToStandard.h>
 #include <mlir/Conversion/StandardToLLVM/ConvertStandardToLLVM.h>
 #include <mlir/Conversion/StandardToLLVM/ConvertStandardToLLVMPass.h>
+#include <mlir/Conversion/VectorToLLVM/ConvertVectorToLLVM.h>
 #include <mlir/Dialect/Affine/Passes.h>
 #include <mlir/Dialect/LLVMIR/LLVMDialect.h>
 #include <mlir/IR/StandardTypes.h>
@@ -74,12 +76,70 @@ static llvm::cl::opt<unsigned> clLoopTilingCacheSize(
                    "inferred from the host CPU using for the cache level specified by "
                    "-ngraph-loop-tile-cache-level."));
 
+static llvm::cl::opt<bool> clEnableAffineLoopParallel(
+    "ngraph-affine-loop-parallel",
+    llvm::cl::init(false),
+    llvm::cl::desc("Run the outermost affine loops without loop-carried dependences across the "
+                   "CPU thread pool"));
+
+static llvm::cl::opt<bool> clEnableAffineVectorization(
+    "ngraph-affine-vectorize",
+    llvm::cl::init(false),
+    llvm::cl::desc("Vectorize innermost affine loops with the Vector dialect"));
+
+static llvm::cl::opt<unsigned> clVectorSize(
+    "ngraph-affine-vector-size",
+    llvm::cl::init(0),
+    llvm::cl::desc("Number of elements per vector in affine loop vectorization. If zero, it is "
+                   "the number of 32-bit elements in a vector register of the host CPU."));
+
 // Enable the lowering of MemRefs to LLVM bare pointers.
 extern llvm::cl::opt<bool> clEnableBarePtrMemRefLowering;
 
 using namespace ngraph::runtime::ngmlir;
 using namespace mlir;
 
+namespace
+{
+    /// Lowers Standard and Vector dialects to LLVM dialect in a single conversion, since
+    /// vector transfers are lowered through the memref descriptors of the Standard
+    /// lowering.
+    class LowerToLLVMWithVectorsPass
+        : public PassWrapper<LowerToLLVMWithVectorsPass, OperationPass<ModuleOp>>
+    {
+    public:
+        explicit LowerToLLVMWithVectorsPass(const LowerToLLVMOptions& options)
+            : options(options)
+        {
+        }
+
+        void runOnOperation() override
+        {
+            LLVMTypeConverter typeConverter(&getContext(), options);
+            OwningRewritePatternList patterns;
+            populateVectorToLLVMMatrixConversionPatterns(typeConverter, patterns);
+            populateVectorToLLVMConversionPatterns(typeConverter, patterns);
+            if (options.useBarePtrCallConv)
+            {
+                populateStdToLLVMBarePtrConversionPatterns(typeConverter, patterns);
+            }
+            else
+            {
+                populateStdToLLVMConversionPatterns(typeConverter, patterns);
+            }
+
+            LLVMConversionTarget target(getContext());
+            if (failed(applyPartialConversion(getOperation(), target, patterns)))
+            {
+                signalPassFailure();
+            }
+        }
+
+    private:
+        LowerToLLVMOptions options;
+    };
+}
+
 // Default optimization level.
 llvm::CodeGenOpt::Level MLIRCPUBackend::mlirOptLevel = llvm::CodeGenOpt::Level::Aggressive;
 
@@ -208,16 +268,22 @@ void MLIRCPUBackend::lowerStandardDialect()
     // 'clEnableBarePtrMemRefLowering' is
     // specified, we lower memref arguments to bare pointers to the memref element
     // type.
+    LowerToLLVMOptions llvmOptions;
     if (clEnableBarePtrMemRefLowering)
     {
-        LowerToLLVMOptions llvmOptions;
-        llvmOptions.useBarePtrCallConv = true, llvmOptions.emitCWrappers = false,
-        pm.addPass(mlir::createLowerToLLVMPass(llvmOptions));
+        llvmOptions.useBarePtrCallConv = true, llvmOptions.emitCWrappers = false;
+    }
+    else
+    {
+        llvmOptions.useBarePtrCallConv = false, llvmOptions.emitCWrappers = true;
+    }
+    // Vectorized loops leave Vector dialect operations behind
+    if (clEnableAffineVectorization)
+    {
+        pm.addPass(std::make_unique<LowerToLLVMWithVectorsPass>(llvmOptions));
     }
     else
     {
-        LowerToLLVMOptions llvmOptions;
-        llvmOptions.useBarePtrCallConv = false, llvmOptions.emitCWrappers = true,
         pm.addPass(mlir::createLowerToLLVMPass(llvmOptions));
     }
 
@@ -273,6 +339,29 @@ void MLIRCPUBackend::optimizeAffineDialect()
         pm.addPass(mlir::createLoopTilingPass(cacheLevelSize));
     }
 
+    // Vectors fill a vector register of the host, assuming 32-bit elements
+    unsigned vectorSize = 1;
+    if (clEnableAffineVectorization)
+    {
+        vectorSize = clVectorSize ? clVectorSize.getValue()
+                                  : std::max(1u, targetInfo.getRegisterBitWidth(true) / 32);
+    }
+
+    // Loops are outlined after tiling, so that threads get whole tiles, and before
+    // vectorization, so that the outlined loops are vectorized too. The runtime can only call
+    // outlined loops with memref descriptors.
+    if (clEnableAffineLoopParallel && !clEnableBarePtrMemRefLowering)
+    {
+        pm.addPass(mlir::createParallelLoopOutliningPass(vectorSize));
+    }
+
+    if (clEnableAffineVectorization)
+    {
+        LLVM_DEBUG(llvm::dbgs() << "Enabling Affine Loop Vectorization with " << vectorSize
+                                << " elements per vector.\n");
+        pm.addPass(mlir::createSuperVectorizePass({static_cast<int64_t>(vectorSize)}));
+    }
+
     // Populate pass manager with affine-to-loop and loop-to-std dialect
     // conversions.
     pm.addPass(mlir::createLowerAffinePass());
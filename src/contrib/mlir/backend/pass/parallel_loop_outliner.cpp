@@ -0,0 +1,297 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+// NOTE: This file follows nGraph format style and MLIR naming convention since
+// it does
+// not expose public API to the rest of nGraph codebase and heavily depends on
+// MLIR API.
+
+#include "parallel_loop_outliner.hpp"
+
+#include <llvm/ADT/SetVector.h>
+#include <llvm/Support/Debug.h>
+#include <mlir/Analysis/AffineAnalysis.h>
+#include <mlir/Analysis/AffineStructures.h>
+#include <mlir/Analysis/LoopAnalysis.h>
+#include <mlir/Dialect/Affine/IR/AffineOps.h>
+#include <mlir/Dialect/StandardOps/IR/Ops.h>
+#include <mlir/IR/BlockAndValueMapping.h>
+#include <mlir/IR/Builders.h>
+#include <mlir/IR/Function.h>
+#include <mlir/IR/Module.h>
+#include <mlir/Transforms/RegionUtils.h>
+
+#define PASS_NAME "ngraph-parallel-loop-outlining"
+#define DEBUG_TYPE PASS_NAME
+
+namespace
+{
+    using namespace mlir;
+
+    /// Outlines the parallel outermost loops of the entry function.
+    ///
+    /// An outlined loop
+    ///
+    ///   affine.for %i = 0 to 128 { ... }
+    ///
+    /// becomes a function that runs a range of its iterations on the arguments of the
+    /// entry function
+    ///
+    ///   func @__ngraph_parallel_body_0(%begin: index, %end: index, <entry arguments>) {
+    ///     affine.for %i = %begin to %end { ... }
+    ///   }
+    ///
+    /// and a call that hands the iteration space to the runtime
+    ///
+    ///   call @callback_parallel_for(%id, %lb, %ub, %step, %grain, %cost)
+    ///
+    /// Only loops that access nothing but the entry arguments are outlined, since the
+    /// runtime can only pass those to the outlined function. The lowering marks them
+    /// noalias, so two accesses can only conflict when they are to the same argument.
+    class ParallelLoopOutliningPass
+        : public PassWrapper<ParallelLoopOutliningPass, OperationPass<ModuleOp>>
+    {
+    public:
+        explicit ParallelLoopOutliningPass(unsigned grain = 1)
+            : grain(grain)
+        {
+        }
+
+        void runOnOperation() override;
+
+    private:
+        bool isOutlinable(FuncOp func, AffineForOp forOp, SmallVectorImpl<Value>& constants);
+        void outline(FuncOp func, AffineForOp forOp, ArrayRef<Value> constants);
+        FuncOp getCallDecl(OpBuilder& builder);
+
+        unsigned grain;
+        unsigned numBodies = 0;
+    };
+
+    /// Returns the number of operations a run of `block` executes, counting the
+    /// operations of loops with a constant trip count once per iteration.
+    static int64_t getCost(Block& block)
+    {
+        int64_t cost = 0;
+        for (auto& op : block.without_terminator())
+        {
+            if (auto forOp = dyn_cast<AffineForOp>(op))
+            {
+                auto tripCount = getConstantTripCount(forOp);
+                cost += (tripCount.hasValue() ? tripCount.getValue() : 1) *
+                        getCost(*forOp.getBody());
+            }
+            else
+            {
+                cost += 1;
+            }
+        }
+        return cost;
+    }
+
+    bool ParallelLoopOutliningPass::isOutlinable(FuncOp func,
+                                                 AffineForOp forOp,
+                                                 SmallVectorImpl<Value>& constants)
+    {
+        if (!forOp.hasConstantBounds())
+        {
+            return false;
+        }
+
+        // Values from the entry function must be its arguments, or constants that can be
+        // copied into the outlined function
+        llvm::SetVector<Value> usedValues;
+        getUsedValuesDefinedAbove(forOp.getLoopBody(), usedValues);
+        for (Value value : usedValues)
+        {
+            if (auto arg = value.dyn_cast<BlockArgument>())
+            {
+                if (arg.getOwner() != &func.front())
+                {
+                    return false;
+                }
+            }
+            else if (isa<ConstantOp>(value.getDefiningOp()))
+            {
+                constants.push_back(value);
+            }
+            else
+            {
+                return false;
+            }
+        }
+
+        // Every memory access must be an affine load or store, so that the dependence
+        // analysis sees all of them
+        SmallVector<Operation*, 8> accesses;
+        bool analyzable = true;
+        forOp.getBody()->walk([&](Operation* op) {
+            if (isa<AffineLoadOp>(op) || isa<AffineStoreOp>(op))
+            {
+                accesses.push_back(op);
+            }
+            else if (isa<CallOp>(op) || isa<CallIndirectOp>(op) || isa<LoadOp>(op) ||
+                     isa<StoreOp>(op) || isa<AllocOp>(op) || isa<DeallocOp>(op) ||
+                     isa<AtomicRMWOp>(op) || isa<GenericAtomicRMWOp>(op) ||
+                     isa<AffineDmaStartOp>(op) || isa<AffineDmaWaitOp>(op))
+            {
+                analyzable = false;
+            }
+        });
+        if (!analyzable)
+        {
+            return false;
+        }
+
+        // No two iterations of the loop may access the same element unless both read it
+        for (Operation* srcOp : accesses)
+        {
+            MemRefAccess srcAccess(srcOp);
+            for (Operation* dstOp : accesses)
+            {
+                MemRefAccess dstAccess(dstOp);
+                FlatAffineConstraints dependenceConstraints;
+                DependenceResult result = checkMemrefAccessDependence(
+                    srcAccess, dstAccess, /*loopDepth=*/1, &dependenceConstraints, nullptr);
+                if (result.value != DependenceResult::NoDependence)
+                {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    FuncOp ParallelLoopOutliningPass::getCallDecl(OpBuilder& builder)
+    {
+        auto module = getOperation();
+        auto callBackFunc = module.lookupSymbol<FuncOp>("callback_parallel_for");
+        if (!callBackFunc)
+        {
+            OpBuilder::InsertionGuard insertGuard(builder);
+            builder.setInsertionPointToStart(module.getBody());
+            auto i64Ty = builder.getIntegerType(64);
+            auto callBackType = builder.getFunctionType(
+                {i64Ty, i64Ty, i64Ty, i64Ty, i64Ty, i64Ty}, llvm::None);
+            SmallVector<NamedAttribute, 4> attributes;
+            callBackFunc = builder.create<FuncOp>(
+                builder.getUnknownLoc(), "callback_parallel_for", callBackType, attributes);
+        }
+        return callBackFunc;
+    }
+
+    void ParallelLoopOutliningPass::outline(FuncOp func,
+                                            AffineForOp forOp,
+                                            ArrayRef<Value> constants)
+    {
+        auto module = getOperation();
+        auto loc = forOp.getLoc();
+        OpBuilder builder(module.getContext());
+
+        // The outlined function takes its range of iterations followed by the entry
+        // arguments, with their attributes
+        unsigned id = numBodies++;
+        auto indexTy = builder.getIndexType();
+        SmallVector<Type, 8> argTypes{indexTy, indexTy};
+        argTypes.append(func.getType().getInputs().begin(), func.getType().getInputs().end());
+        auto body = FuncOp::create(loc,
+                                   ngraph::runtime::ngmlir::parallelBodyPrefix +
+                                       std::to_string(id),
+                                   builder.getFunctionType(argTypes, llvm::None));
+        for (unsigned i = 0, e = func.getNumArguments(); i < e; ++i)
+        {
+            body.setArgAttrs(i + 2, func.getArgAttrs(i));
+        }
+        module.push_back(body);
+
+        Block* entry = body.addEntryBlock();
+        builder.setInsertionPointToStart(entry);
+        BlockAndValueMapping mapping;
+        for (unsigned i = 0, e = func.getNumArguments(); i < e; ++i)
+        {
+            mapping.map(func.getArgument(i), entry->getArgument(i + 2));
+        }
+        for (Value constant : constants)
+        {
+            builder.clone(*constant.getDefiningOp(), mapping);
+        }
+        auto symbolMap = builder.getSymbolIdentityMap();
+        auto loop = builder.create<AffineForOp>(loc,
+                                                ValueRange{entry->getArgument(0)},
+                                                symbolMap,
+                                                ValueRange{entry->getArgument(1)},
+                                                symbolMap,
+                                                forOp.getStep());
+        mapping.map(forOp.getInductionVar(), loop.getInductionVar());
+        builder.setInsertionPointToStart(loop.getBody());
+        for (auto& op : forOp.getBody()->without_terminator())
+        {
+            builder.clone(op, mapping);
+        }
+        builder.setInsertionPointAfter(loop);
+        builder.create<ReturnOp>(loc);
+
+        // The loop is replaced with a call that runs the outlined function across the
+        // thread pool
+        builder.setInsertionPoint(forOp);
+        auto callBackFunc = getCallDecl(builder);
+        SmallVector<Value, 6> operands;
+        for (int64_t value : {static_cast<int64_t>(id),
+                              forOp.getConstantLowerBound(),
+                              forOp.getConstantUpperBound(),
+                              static_cast<int64_t>(forOp.getStep()),
+                              static_cast<int64_t>(grain),
+                              getCost(*forOp.getBody())})
+        {
+            operands.push_back(builder.create<ConstantIntOp>(loc, value, 64));
+        }
+        builder.create<CallOp>(loc, callBackFunc, operands);
+        forOp.erase();
+
+        LLVM_DEBUG(llvm::dbgs() << "Outlined parallel loop into " << body.getName() << "\n");
+    }
+
+    void ParallelLoopOutliningPass::runOnOperation()
+    {
+        auto func = getOperation().lookupSymbol<FuncOp>("main");
+        if (!func || func.isExternal())
+        {
+            return;
+        }
+
+        SmallVector<AffineForOp, 4> loops;
+        for (auto forOp : func.front().getOps<AffineForOp>())
+        {
+            loops.push_back(forOp);
+        }
+        for (auto forOp : loops)
+        {
+            SmallVector<Value, 4> constants;
+            if (isOutlinable(func, forOp, constants))
+            {
+                outline(func, forOp, constants);
+            }
+        }
+    }
+}
+
+std::unique_ptr<mlir::Pass> mlir::createParallelLoopOutliningPass(unsigned grain)
+{
+    return std::make_unique<ParallelLoopOutliningPass>(grain);
+}
+
+static mlir::PassRegistration<ParallelLoopOutliningPass>
+    pass(PASS_NAME, "Outline parallel affine loops to run them across the CPU thread pool");
@@ -0,0 +1,45 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+// NOTE: This file follows nGraph format style and MLIR naming convention since
+// it does
+// not expose public API to the rest of nGraph codebase and heavily depends on
+// MLIR API.
+
+#pragma once
+
+#include <mlir/Pass/Pass.h>
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace ngmlir
+        {
+            /// Outlined loop bodies are named with this prefix followed by their index
+            constexpr const char* parallelBodyPrefix = "__ngraph_parallel_body_";
+        }
+    }
+}
+
+namespace mlir
+{
+    /// Moves the outermost affine loops of the entry function whose iterations are
+    /// independent into functions of their own, which the runtime runs on chunks of the
+    /// iteration space across the CPU thread pool. The chunks are a multiple of `grain`
+    /// iterations, so that vectorized loops never share a vector between threads.
+    std::unique_ptr<Pass> createParallelLoopOutliningPass(unsigned grain);
+}
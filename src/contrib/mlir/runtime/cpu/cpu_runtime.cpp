@@ -20,7 +20,9 @@
 
 #include "cpu_runtime.hpp"
 #include "contrib/mlir/backend/cpu/cpu_backend.hpp"
+#include "contrib/mlir/backend/pass/parallel_loop_outliner.hpp"
 #include "ngraph/check.hpp"
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
 
 #include <llvm/ADT/STLExtras.h>
 #include <llvm/Analysis/TargetTransformInfo.h>
@@ -63,6 +65,9 @@ llvm::cl::opt<bool> clEnableBarePtrMemRefLowering(
     llvm::cl::init(false),
     llvm::cl::desc("Enable the lowering of MemRefs to LLVM bare pointers"));
 
+// The runtime whose entry point is running on this thread, for the parallel loop callback
+static thread_local MLIRCPURuntime* currentRuntime = nullptr;
+
 void MLIRCPURuntime::run(const std::vector<MemRefArg>& args, bool firstIteration)
 {
     run_internal(args, firstIteration);
@@ -84,6 +89,20 @@ void MLIRCPURuntime::run_internal(const std::vector<MemRefArg>& args, bool first
             m_module.get(), llvmTransformer, MLIRCPUBackend::mlirOptLevel);
         NGRAPH_CHECK(maybeEngine, "failed to construct an execution engine");
         m_engine = std::move(maybeEngine.get());
+
+        // Look up the outlined parallel loops once, so that threads only call them
+        for (size_t i = 0;; ++i)
+        {
+            auto name = parallelBodyPrefix + std::to_string(i);
+            if (!m_module->lookupSymbol<mlir::LLVM::LLVMFuncOp>(name))
+            {
+                break;
+            }
+            auto body =
+                m_engine->lookup(clEnableBarePtrMemRefLowering ? name : "_mlir_ciface_" + name);
+            NGRAPH_CHECK(body, "Outlined parallel loop ", name, " not found");
+            m_parallelBodies.push_back(*body);
+        }
     }
 
     bindArguments(args);
@@ -172,8 +191,10 @@ void MLIRCPURuntime::execute(bool firstIteration)
                          "JIT invocation of '_mlir_ciface_callback_init' failed\n");
         }
 
+        currentRuntime = this;
         auto invocationResult =
             m_engine->invoke("_mlir_ciface_main", llvm::MutableArrayRef<void*>(m_invokeArgs));
+        currentRuntime = nullptr;
         if (clDumpObjectFile)
         {
             m_engine->dumpToObjectFile(clObjectFilename.empty() ? "jitted_mlir.o"
@@ -183,8 +204,10 @@ void MLIRCPURuntime::execute(bool firstIteration)
     }
     else
     {
+        currentRuntime = this;
         auto invocationResult =
             m_engine->invoke("main", llvm::MutableArrayRef<void*>(m_invokeArgs));
+        currentRuntime = nullptr;
         if (clDumpObjectFile)
         {
             m_engine->dumpToObjectFile(clObjectFilename.empty() ? "jitted_mlir.o"
@@ -194,6 +217,44 @@ void MLIRCPURuntime::execute(bool firstIteration)
     }
 }
 
+void MLIRCPURuntime::parallelFor(int64_t bodyId,
+                                 int64_t lowerBound,
+                                 int64_t upperBound,
+                                 int64_t step,
+                                 int64_t grain,
+                                 int64_t cost)
+{
+    NGRAPH_CHECK(bodyId >= 0 && static_cast<size_t>(bodyId) < m_parallelBodies.size(),
+                 "Invalid parallel loop ",
+                 bodyId);
+    auto body = m_parallelBodies[bodyId];
+    int64_t tripCount = std::max<int64_t>(0, (upperBound - lowerBound + step - 1) / step);
+    int64_t numChunks = (tripCount + grain - 1) / grain;
+
+    // The outlined loop takes its bounds followed by the arguments of the entry point
+    auto runChunks = [&](Eigen::Index first, Eigen::Index last) {
+        int64_t begin = lowerBound + first * grain * step;
+        int64_t end = std::min(upperBound, lowerBound + last * grain * step);
+        SmallVector<void*, 8> args{&begin, &end};
+        args.append(m_invokeArgs.begin(), m_invokeArgs.end());
+        body(args.data());
+    };
+    auto& device = ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(m_arena);
+    device.parallelFor(numChunks, Eigen::TensorOpCost(0, 0, grain * cost), runChunks);
+}
+
+// Called by the entry point in place of each outlined parallel loop
+extern "C" void _mlir_ciface_callback_parallel_for(int64_t bodyId,
+                                                   int64_t lowerBound,
+                                                   int64_t upperBound,
+                                                   int64_t step,
+                                                   int64_t grain,
+                                                   int64_t cost)
+{
+    NGRAPH_CHECK(currentRuntime, "Parallel loop called outside of an MLIR entry point");
+    currentRuntime->parallelFor(bodyId, lowerBound, upperBound, step, grain, cost);
+}
+
 void MLIRCPURuntime::cleanup()
 {
     // Free void double pointer arguments without freeing external tensor data.
@@ -58,6 +58,21 @@ namespace ngraph
                 /// Executes a pre-compiled subgraph
                 void run(const std::vector<MemRefArg>& args, bool firstIteration) override;
 
+                /// Sets the CPU thread pool arena the parallel loops of the following runs use,
+                /// the one of the execution context the compiled kernel runs on
+                void set_arena(int arena) { m_arena = arena; }
+
+                /// Runs the iterations from lowerBound to upperBound of an outlined parallel
+                /// loop across the thread pool of the arena set by set_arena, in chunks of a
+                /// multiple of grain iterations. cost is the number of operations of one
+                /// iteration.
+                void parallelFor(int64_t bodyId,
+                                 int64_t lowerBound,
+                                 int64_t upperBound,
+                                 int64_t step,
+                                 int64_t grain,
+                                 int64_t cost);
+
             private:
                 void run_internal(const std::vector<MemRefArg>& args, bool firstIteration);
                 // Bind external tensors to MLIR module entry point
@@ -82,7 +97,10 @@ namespace ngraph
                 // Arguments for the MLIR function generated for the nGraph sub-graph.
                 llvm::SmallVector<void*, 8> m_invokeArgs;
                 std::unique_ptr<::mlir::ExecutionEngine> m_engine;
+                // Packed entry points of the outlined parallel loops, by index
+                std::vector<void (*)(void**)> m_parallelBodies;
                 std::vector<size_t> m_ranks;
+                int m_arena = 0;
             };
         }
     }
@@ -14,10 +14,24 @@
 // limitations under the License.
 //*****************************************************************************
 
-#include <iostream>
-#include <map>
-#include <sstream>
+#include <algorithm>
+#include <condition_variable>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+#ifdef _WIN32
+#include <windows.h>
+// windows.h must be before processthreadsapi.h so we need this comment
+#include <processthreadsapi.h>
+#define getpid() GetCurrentProcessId()
+#else
+#include <unistd.h>
+#endif
 
 #include "chrome_trace.hpp"
 #include "ngraph/env_util.hpp"
@@ -33,176 +47,346 @@ static bool read_tracing_env_var()
     return is_enabled;
 }
 
-mutex event::Manager::s_file_mutex;
-bool event::Manager::s_tracing_enabled = read_tracing_env_var();
+atomic<bool> event::Manager::s_tracing_enabled(read_tracing_env_var());
 
-event::Duration::Duration(const string& name, const string& category, const string& args)
+namespace
 {
-    if (Manager::is_tracing_enabled())
-    {
-        m_start = Manager::get_current_microseconds();
-        m_stop = 0;
-        m_name = name;
-        m_category = category;
-        m_args = args;
-    }
-}
+    atomic<size_t> s_sampling_interval(max(1, getenv_int("NGRAPH_TRACING_SAMPLING_INTERVAL", 1)));
 
-void event::Duration::stop()
-{
-    if (Manager::is_tracing_enabled())
+    /// \brief Events of one thread. Only that thread pushes, and only the thread holding the
+    ///        trace mutex drains, so the two ends meet through the head and tail counters
+    ///        alone.
+    class Ring
     {
-        m_stop = Manager::get_current_microseconds();
-    }
-}
+    public:
+        static constexpr size_t capacity = 1 << 14;
 
-void event::Duration::write()
-{
-    if (Manager::is_tracing_enabled())
+        explicit Ring(size_t thread_index)
+            : m_thread_index(thread_index)
+            , m_records(capacity)
+        {
+        }
+
+        void push(const event::Record& record)
+        {
+            size_t head = m_head.load(memory_order_relaxed);
+            if (head - m_tail.load(memory_order_acquire) == capacity)
+            {
+                m_dropped.fetch_add(1, memory_order_relaxed);
+                return;
+            }
+            m_records[head % capacity] = record;
+            m_head.store(head + 1, memory_order_release);
+        }
+
+        template <typename F>
+        void drain(F f)
+        {
+            size_t tail = m_tail.load(memory_order_relaxed);
+            size_t head = m_head.load(memory_order_acquire);
+            for (; tail != head; ++tail)
+            {
+                f(m_records[tail % capacity]);
+            }
+            m_tail.store(tail, memory_order_release);
+        }
+
+        size_t take_dropped() { return m_dropped.exchange(0, memory_order_relaxed); }
+        size_t get_thread_index() const { return m_thread_index; }
+
+    private:
+        const size_t m_thread_index;
+        vector<event::Record> m_records;
+        atomic<size_t> m_head{0};
+        atomic<size_t> m_tail{0};
+        atomic<size_t> m_dropped{0};
+    };
+
+    /// \brief The rings of all threads and the file they are written to
+    class Trace
     {
-        size_t stop_time = (m_stop != 0 ? m_stop : Manager::get_current_microseconds());
+    public:
+        static Trace& get()
+        {
+            static Trace trace;
+            return trace;
+        }
 
-        lock_guard<mutex> lock(Manager::get_mutex());
+        ~Trace()
+        {
+            {
+                lock_guard<mutex> lock(m_mutex);
+                m_stopping = true;
+            }
+            m_stop.notify_all();
+            if (m_flusher.joinable())
+            {
+                m_flusher.join();
+            }
+            close();
+        }
 
-        ofstream& out = event::Manager::get_output_stream();
-        string str;
-        if (out.is_open() == false)
+        shared_ptr<Ring> add_ring()
         {
-            event::Manager::open();
+            lock_guard<mutex> lock(m_mutex);
+            m_rings.push_back(make_shared<Ring>(m_next_thread_index++));
+            if (!m_flusher.joinable() && m_flush_interval.count() > 0)
+            {
+                m_flusher = thread(&Trace::run_flusher, this);
+            }
+            return m_rings.back();
         }
-        else
+
+        void open(const string& path)
         {
-            str += ",\n";
+            lock_guard<mutex> lock(m_mutex);
+            open_locked(path);
         }
 
-        str +=
-            R"({"name":")" + m_name + R"(","cat":")" + m_category + R"(","ph":"X","pid":)" +
-            Manager::get_process_id() + R"(,"tid":)" + Manager::get_thread_id() +
-            R"(,"ts":)" + to_string(m_start) + R"(,"dur":)" + to_string(stop_time - m_start);
-        if (!m_args.empty())
+        void flush()
         {
-            str += R"(,"args":)" + m_args;
+            lock_guard<mutex> lock(m_mutex);
+            flush_locked();
         }
-        str += "}";
-        out << str;
-    }
-}
 
-event::Object::Object(const string& name, const string& args)
-    : m_name{name}
-    , m_id{static_cast<size_t>(chrono::high_resolution_clock::now().time_since_epoch().count())}
-{
-    if (Manager::is_tracing_enabled())
-    {
-        lock_guard<mutex> lock(Manager::get_mutex());
+        void close()
+        {
+            lock_guard<mutex> lock(m_mutex);
+            flush_locked();
+            if (m_out.is_open())
+            {
+                m_out << "\n]\n";
+                m_out.close();
+            }
+        }
+
+    private:
+        Trace()
+            : m_flush_interval(getenv_int("NGRAPH_TRACING_FLUSH_INTERVAL", 100))
+            , m_pid(to_string(getpid()))
+        {
+        }
 
-        ofstream& out = event::Manager::get_output_stream();
-        string str;
-        if (out.is_open() == false)
+        void open_locked(const string& path)
         {
-            event::Manager::open();
+            if (!m_out.is_open())
+            {
+                m_out.open(path, ios_base::trunc);
+                m_out << "[\n";
+                m_first_event = true;
+            }
         }
-        else
+
+        void flush_locked()
         {
-            str += ",\n";
+            for (auto it = m_rings.begin(); it != m_rings.end();)
+            {
+                Ring& ring = **it;
+                // A ring nobody else holds belongs to a thread that has exited. That has to be
+                // decided before draining: a thread that is still running can push after the
+                // drain, and its ring must stay until those events are written too. The fence
+                // makes the last pushes of an exited thread visible to the drain.
+                bool exited = it->use_count() == 1;
+                if (exited)
+                {
+                    atomic_thread_fence(memory_order_acquire);
+                }
+                ring.drain([this, &ring](const event::Record& record) {
+                    write_event(record, ring.get_thread_index());
+                });
+                if (size_t dropped = ring.take_dropped())
+                {
+                    string args = R"({"count":)" + to_string(dropped) + "}";
+                    event::Record record;
+                    record.m_phase = 'C';
+                    record.set_name("dropped events");
+                    record.m_timestamp = chrono::high_resolution_clock::now()
+                                             .time_since_epoch()
+                                             .count() /
+                                         1000;
+                    record.m_args = &args;
+                    write_event(record, ring.get_thread_index());
+                }
+                it = exited ? m_rings.erase(it) : it + 1;
+            }
+            m_out.flush();
         }
-        str += R"({"name":")" + m_name + R"(","ph":"N","id":")" + to_string(m_id) +
-               R"(","ts":)" + to_string(Manager::get_current_microseconds()) +
-               R"(,"pid":)" + Manager::get_process_id() + R"(,"tid":)" + Manager::get_thread_id();
-        if (!args.empty())
+
+        void write_event(const event::Record& record, size_t thread_index)
+        {
+            open_locked("runtime_event_trace.json");
+            string str = m_first_event ? "" : ",\n";
+            m_first_event = false;
+            str += R"({"name":")";
+            str += record.m_name;
+            str += '"';
+            switch (record.m_phase)
+            {
+            case 'X':
+                str += R"(,"cat":")";
+                str += record.m_category;
+                str += R"(","ph":"X","pid":)" + m_pid + R"(,"tid":)" + to_string(thread_index) +
+                       R"(,"ts":)" + to_string(record.m_timestamp) + R"(,"dur":)" +
+                       to_string(record.m_value);
+                break;
+            case 'C':
+                str += R"(,"ph":"C","pid":)" + m_pid + R"(,"tid":)" + to_string(thread_index) +
+                       R"(,"ts":)" + to_string(record.m_timestamp);
+                break;
+            default:
+                str += R"(,"ph":")" + string(1, record.m_phase) + R"(","id":")" +
+                       to_string(record.m_value) + R"(","ts":)" + to_string(record.m_timestamp) +
+                       R"(,"pid":)" + m_pid + R"(,"tid":)" + to_string(thread_index);
+                break;
+            }
+            if (record.m_args != nullptr)
+            {
+                str += R"(,"args":)" + *record.m_args;
+            }
+            str += "}";
+            m_out << str;
+        }
+
+        void run_flusher()
         {
-            str += R"(,"args":)" + args;
+            unique_lock<mutex> lock(m_mutex);
+            while (!m_stop.wait_for(lock, m_flush_interval, [this] { return m_stopping; }))
+            {
+                flush_locked();
+            }
         }
-        str += "}";
 
-        write_snapshot(out, args);
+        mutex m_mutex;
+        vector<shared_ptr<Ring>> m_rings;
+        size_t m_next_thread_index{0};
+        ofstream m_out;
+        bool m_first_event{true};
+        const chrono::milliseconds m_flush_interval;
+        const string m_pid;
+        thread m_flusher;
+        condition_variable m_stop;
+        bool m_stopping{false};
+    };
+
+    Ring& get_thread_ring()
+    {
+        static thread_local shared_ptr<Ring> ring = Trace::get().add_ring();
+        return *ring;
+    }
+
+    // Arguments are rare, so they are kept once each for the life of the process
+    const string* intern_args(const string& args)
+    {
+        if (args.empty())
+        {
+            return nullptr;
+        }
+        static mutex* args_mutex = new mutex();
+        static unordered_set<string>* all_args = new unordered_set<string>();
+        lock_guard<mutex> lock(*args_mutex);
+        return &*all_args->insert(args).first;
+    }
+
+    void copy_truncated(char* destination, size_t size, const string& source)
+    {
+        size_t length = min(size - 1, source.size());
+        memcpy(destination, source.data(), length);
+        destination[length] = 0;
     }
 }
 
-void event::Object::snapshot(const string& args)
+void event::Record::set_name(const string& name)
 {
-    if (Manager::is_tracing_enabled())
+    copy_truncated(m_name, name_size, name);
+}
+
+void event::Record::set_category(const string& category)
+{
+    copy_truncated(m_category, category_size, category);
+}
+
+event::Duration::Duration(const string& name, const string& category, const string& args)
+{
+    if (Manager::is_tracing_enabled() && Manager::sample())
     {
-        lock_guard<mutex> lock(Manager::get_mutex());
+        m_record.m_phase = 'X';
+        m_record.set_name(name);
+        m_record.set_category(category);
+        m_record.m_args = intern_args(args);
+        m_record.m_timestamp = Manager::get_current_microseconds();
+    }
+}
 
-        ofstream& out = event::Manager::get_output_stream();
-        if (out.is_open() == false)
-        {
-            event::Manager::open();
-        }
-        else
-        {
-            Manager::get_output_stream() << ",\n";
-        }
-        write_snapshot(out, args);
+void event::Duration::stop()
+{
+    if (m_record.m_phase != 0)
+    {
+        m_stop = Manager::get_current_microseconds();
     }
 }
 
-void event::Object::write_snapshot(ostream& out, const string& args)
+void event::Duration::write()
 {
-    string str = R"({"name":")" + m_name + R"(","ph":"O","id":")" + to_string(m_id) +
-                 R"(","ts":)" + to_string(Manager::get_current_microseconds()) +
-                 R"(,"pid":)" + Manager::get_process_id() + R"(,"tid":)" + Manager::get_thread_id();
-    if (!args.empty())
+    if (m_record.m_phase != 0)
     {
-        str += R"(,"args":)" + args;
+        size_t stop_time = (m_stop != 0 ? m_stop : Manager::get_current_microseconds());
+        m_record.m_value = stop_time - m_record.m_timestamp;
+        Manager::record(m_record);
+        m_record.m_phase = 0;
     }
-    str += "}";
-    out << str;
 }
 
-void event::Object::destroy()
+event::Object::Object(const string& name, const string& args)
+    : m_name{name}
+    , m_id{static_cast<size_t>(chrono::high_resolution_clock::now().time_since_epoch().count())}
 {
     if (Manager::is_tracing_enabled())
     {
-        lock_guard<mutex> lock(Manager::get_mutex());
-
-        ofstream& out = event::Manager::get_output_stream();
-        if (out.is_open() == false)
-        {
-            event::Manager::open();
-        }
-        else
-        {
-            Manager::get_output_stream() << ",\n";
-        }
-        string str = R"({"name":")" + m_name + R"(","ph":"D","id":")" + to_string(m_id) +
-                     R"(","ts":)" + to_string(Manager::get_current_microseconds()) +
-                     R"(,"pid":)" + Manager::get_process_id() + R"(,"tid":)" +
-                     Manager::get_thread_id() + "}";
+        write('N', "");
+        write('O', args);
     }
 }
 
-void event::Manager::open(const string& path)
+void event::Object::snapshot(const string& args)
 {
-    ofstream& out = get_output_stream();
-    if (out.is_open() == false)
+    if (Manager::is_tracing_enabled())
     {
-        out.open(path, ios_base::trunc);
-        out << "[\n";
+        write('O', args);
     }
 }
 
-void event::Manager::close()
+void event::Object::write(char phase, const string& args)
 {
-    ofstream& out = get_output_stream();
-    if (out.is_open())
+    Record record;
+    record.m_phase = phase;
+    record.set_name(m_name);
+    record.m_timestamp = Manager::get_current_microseconds();
+    record.m_value = m_id;
+    record.m_args = intern_args(args);
+    Manager::record(record);
+}
+
+void event::Object::destroy()
+{
+    if (Manager::is_tracing_enabled())
     {
-        out << "\n]\n";
-        out.close();
+        write('D', "");
     }
 }
 
-ofstream& event::Manager::get_output_stream()
+void event::Manager::open(const string& path)
 {
-    static ofstream s_event_log;
-    return s_event_log;
+    Trace::get().open(path);
 }
 
-const string& event::Manager::get_process_id()
+void event::Manager::close()
 {
-    static const string s_pid = to_string(getpid());
-    return s_pid;
+    Trace::get().close();
+}
+
+void event::Manager::flush()
+{
+    Trace::get().flush();
 }
 
 void event::Manager::enable_event_tracing()
@@ -220,22 +404,23 @@ bool event::Manager::is_event_tracing_enabled()
     return s_tracing_enabled;
 }
 
-string event::Manager::get_thread_id()
+void event::Manager::set_sampling_interval(size_t interval)
 {
-    thread::id tid = this_thread::get_id();
-    static map<thread::id, string> tid_map;
-    auto it = tid_map.find(tid);
-    string rc;
-    if (it == tid_map.end())
-    {
-        stringstream ss;
-        ss << "\"" << tid << "\"";
-        rc = ss.str();
-        tid_map.insert({tid, rc});
-    }
-    else
+    s_sampling_interval = max<size_t>(1, interval);
+}
+
+bool event::Manager::sample()
+{
+    size_t interval = s_sampling_interval.load(memory_order_relaxed);
+    if (interval == 1)
     {
-        rc = it->second;
+        return true;
     }
-    return rc;
+    static thread_local size_t count = 0;
+    return ++count % interval == 0;
+}
+
+void event::Manager::record(const Record& record)
+{
+    get_thread_ring().push(record);
 }
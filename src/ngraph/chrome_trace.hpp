@@ -16,20 +16,10 @@
 
 #pragma once
 
+#include <atomic>
 #include <chrono>
-#include <fstream>
-#include <iostream>
-#include <mutex>
+#include <cstddef>
 #include <string>
-#include <thread>
-#ifdef _WIN32
-#include <windows.h>
-// windows.h must be before processthreadsapi.h so we need this comment
-#include <processthreadsapi.h>
-#define getpid() GetCurrentProcessId()
-#else
-#include <unistd.h>
-#endif
 
 #include <ngraph/ngraph_visibility.hpp>
 
@@ -40,6 +30,7 @@ namespace ngraph
         class Duration;
         class Object;
         class Manager;
+        struct Record;
     }
 }
 
@@ -73,32 +64,65 @@ namespace ngraph
 //
 // More information about this is at:
 // http://dev.chromium.org/developers/how-tos/trace-event-profiling-tool
+//
+// Events are not written as they happen. Each thread appends them to a ring buffer of its
+// own without taking any lock, and the buffers are written to the trace file every
+// NGRAPH_TRACING_FLUSH_INTERVAL milliseconds, on flush() and on close(). Events that find
+// the buffer of their thread full are dropped and counted in the trace. Setting
+// NGRAPH_TRACING_SAMPLING_INTERVAL to n records one in n durations of each thread.
+
+/// \brief A trace event in the fixed size form it is buffered in until it is written. Names
+///        that do not fit are truncated.
+struct NGRAPH_API ngraph::event::Record
+{
+    static constexpr size_t name_size = 48;
+    static constexpr size_t category_size = 24;
+
+    void set_name(const std::string& name);
+    void set_category(const std::string& category);
+
+    /// \brief Chrome trace phase, 'X' for a duration or 'N', 'O' and 'D' for an object, 0 for
+    ///        no event
+    char m_phase{0};
+    /// \brief Start of the event in microseconds
+    size_t m_timestamp{0};
+    /// \brief Length of a duration in microseconds, or id of an object
+    size_t m_value{0};
+    /// \brief Arguments of the event as JSON, shared by every event with the same arguments
+    const std::string* m_args{nullptr};
+    char m_name[name_size];
+    char m_category[category_size];
+};
 
-class ngraph::event::Manager
+class NGRAPH_API ngraph::event::Manager
 {
     friend class Duration;
     friend class Object;
 
 public:
     static void open(const std::string& path = "runtime_event_trace.json");
+    /// \brief Write the buffered events and close the trace file
     static void close();
-    static bool is_tracing_enabled() { return s_tracing_enabled; }
+    /// \brief Write the events buffered by every thread to the trace file, opening it at
+    ///        the default path if it is not open
+    static void flush();
+    static bool is_tracing_enabled() { return s_tracing_enabled.load(std::memory_order_relaxed); }
     static void enable_event_tracing();
     static void disable_event_tracing();
     static bool is_event_tracing_enabled();
+    /// \brief Record one in \p interval durations of each thread
+    static void set_sampling_interval(size_t interval);
 
 private:
-    static std::ofstream& get_output_stream();
-    static const std::string& get_process_id();
     static size_t get_current_microseconds()
     {
         return std::chrono::high_resolution_clock::now().time_since_epoch().count() / 1000;
     }
-    static std::string get_thread_id();
-    static std::mutex& get_mutex() { return s_file_mutex; }
-    static std::ostream s_ostream;
-    static std::mutex s_file_mutex;
-    static bool s_tracing_enabled;
+    /// \brief Whether the next duration of this thread is recorded
+    static bool sample();
+    /// \brief Buffer \p record for the trace file without blocking
+    static void record(const Record& record);
+    static std::atomic<bool> s_tracing_enabled;
 };
 
 class NGRAPH_API ngraph::event::Duration
@@ -114,22 +138,19 @@ public:
     void stop();
 
     /// \brief write the log data to the log file for this event
-    /// This funtion has an implicit stop() if stop() has not been previously called
+    /// This funtion has an implicit stop() if stop() has not been previously called. Only the
+    /// first call writes the event.
     void write();
 
     Duration(const Duration&) = delete;
     Duration& operator=(Duration const&) = delete;
 
 private:
-    std::string to_json() const;
-    size_t m_start{0};
+    Record m_record;
     size_t m_stop{0};
-    std::string m_name;
-    std::string m_category;
-    std::string m_args;
 };
 
-class ngraph::event::Object
+class NGRAPH_API ngraph::event::Object
 {
 public:
     Object(const std::string& name, const std::string& args);
@@ -137,7 +158,7 @@ public:
     void destroy();
 
 private:
-    void write_snapshot(std::ostream& out, const std::string& args);
+    void write(char phase, const std::string& args);
     const std::string m_name;
     size_t m_id{0};
 };
@@ -272,8 +272,7 @@ bool cpio::Reader::read(const string& file_name, void* data, size_t size_in_byte
             {
                 throw runtime_error("Buffer size does not match file size");
             }
-            m_stream->seekg(info.get_offset(), ios_base::beg);
-            m_stream->read(reinterpret_cast<char*>(data), size_in_bytes);
+            read(info, data);
             rc = true;
             break;
         }
@@ -281,10 +280,16 @@ bool cpio::Reader::read(const string& file_name, void* data, size_t size_in_byte
     return rc;
 }
 
+void cpio::Reader::read(const FileInfo& info, void* data)
+{
+    m_stream->seekg(info.get_offset(), ios_base::beg);
+    m_stream->read(reinterpret_cast<char*>(data), info.get_size());
+}
+
 vector<char> cpio::Reader::read(const FileInfo& info)
 {
     vector<char> buffer(info.get_size());
-    read(info.get_name(), buffer.data(), info.get_size());
+    read(info, buffer.data());
     return buffer;
 }
 
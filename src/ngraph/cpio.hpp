@@ -110,6 +110,8 @@ public:
     void close();
     const std::vector<FileInfo>& get_file_info();
     bool read(const std::string& file_name, void* data, size_t size_in_bytes);
+    /// \brief Read the data of \p info, an entry of get_file_info(), without looking it up
+    void read(const FileInfo& info, void* data);
     std::vector<char> read(const FileInfo& info);
 
 private:
@@ -32,6 +32,7 @@ descriptor::Input::Input(Node* node, size_t index, Output& output)
 {
     m_src_node = std::shared_ptr<Node>(output.get_node());
     output.add_input(this);
+    m_node->graph_changed();
 }
 
 descriptor::Input::Input(Node* node, size_t index)
@@ -43,6 +44,21 @@ descriptor::Input::Input(Node* node, size_t index)
 {
 }
 
+descriptor::Input::Input(Input&& input) noexcept
+    : m_src_node(std::move(input.m_src_node))
+    , m_node(input.m_node)
+    , m_index(input.m_index)
+    , m_output(input.m_output)
+    , m_is_relevant_to_shape(input.m_is_relevant_to_shape)
+    , m_is_relevant_to_value(input.m_is_relevant_to_value)
+{
+    if (m_output != nullptr)
+    {
+        m_output->replace_input(&input, this);
+        input.m_output = nullptr;
+    }
+}
+
 descriptor::Input::~Input()
 {
     remove_output();
@@ -57,6 +73,7 @@ void descriptor::Input::replace_output(Output& new_output)
     new_output.add_input(this);
     m_output = &new_output;
     m_src_node = std::shared_ptr<Node>(new_output.get_node());
+    m_node->graph_changed();
 
     if (getenv_bool("NGRAPH_ENABLE_REPLACE_CHECK"))
     {
@@ -79,6 +96,7 @@ void descriptor::Input::remove_output()
         m_output->remove_input(this);
         m_src_node = nullptr;
         m_output = nullptr;
+        m_node->graph_changed();
     }
 }
 
@@ -32,6 +32,7 @@ namespace ngraph
         class NGRAPH_API Input
         {
             friend class ngraph::Node;
+            friend class Output;
 
         public:
             /// \param node The node that owns this input
@@ -101,7 +102,9 @@ namespace ngraph
             const element::Type& get_element_type() const;
 
             Input(const Input&) = default;
-            Input(Input&&) = default;
+            /// \brief Take the place of \p input in the inputs of its output, so that nodes can
+            ///        keep their inputs in a vector
+            Input(Input&& input) noexcept;
             Input& operator=(const Input&) = default;
 
         protected:
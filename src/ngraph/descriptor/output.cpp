@@ -30,6 +30,18 @@ descriptor::Output::Output(Node* node, size_t index, const shared_ptr<Tensor>& t
 {
 }
 
+descriptor::Output::Output(Output&& output) noexcept
+    : m_node(output.m_node)
+    , m_index(output.m_index)
+    , m_tensor(move(output.m_tensor))
+    , m_inputs(move(output.m_inputs))
+{
+    for (Input* input : m_inputs)
+    {
+        input->m_output = this;
+    }
+}
+
 // Add an input to the vector of inputs that use this output.
 void descriptor::Output::add_input(Input* input)
 {
@@ -49,6 +61,15 @@ void descriptor::Output::remove_input(Input* input)
     }
 }
 
+void descriptor::Output::replace_input(Input* input, Input* replacement)
+{
+    auto it = find(m_inputs.begin(), m_inputs.end(), input);
+    if (it != m_inputs.end())
+    {
+        *it = replacement;
+    }
+}
+
 shared_ptr<Node> descriptor::Output::get_node() const
 {
     return m_node->shared_from_this();
@@ -25,7 +25,7 @@
 
 namespace ngraph
 {
-    // The forward declaration of Node is needed here because Node has a deque of
+    // The forward declaration of Node is needed here because Node has a vector of
     // Outputs, and Output is an incomplete type at this point. STL containers of
     // incomplete type have undefined behavior according to the C++11 standard, and
     // in practice including node.hpp here was causing compilation errors on some
@@ -50,6 +50,7 @@ namespace ngraph
             void set_tensor_ptr(const std::shared_ptr<Tensor>& tensor) { m_tensor = tensor; }
             void add_input(Input* input);
             void remove_input(Input* input);
+            void replace_input(Input* input, Input* replacement);
             const std::vector<Input*>& get_inputs() const { return m_inputs; }
             Tensor& get_tensor() const;
 
@@ -63,7 +64,9 @@ namespace ngraph
             const element::Type& get_element_type() const;
 
             Output(const Output&) = default;
-            Output(Output&&) = default;
+            /// \brief Point the inputs of \p output at this output instead, so that nodes can
+            ///        keep their outputs in a vector
+            Output(Output&& output) noexcept;
             Output& operator=(const Output&) = default;
 
         protected:
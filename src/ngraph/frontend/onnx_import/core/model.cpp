@@ -24,8 +24,9 @@ namespace ngraph
 {
     namespace onnx_import
     {
-        Model::Model(const ONNX_NAMESPACE::ModelProto& model_proto)
+        Model::Model(const ONNX_NAMESPACE::ModelProto& model_proto, const std::string& model_dir)
             : m_model_proto{&model_proto}
+            , m_model_dir{model_dir}
         {
             // Walk through the elements of opset_import field and register operator sets
             // for each domain. An exception UnknownDomain() will raise if the domain is
@@ -31,7 +31,10 @@ namespace ngraph
         {
         public:
             Model() = delete;
-            explicit Model(const ONNX_NAMESPACE::ModelProto& model_proto);
+            /// \param model_dir The directory that the locations of external tensor data are
+            ///                  relative to, normally the directory of the model file.
+            explicit Model(const ONNX_NAMESPACE::ModelProto& model_proto,
+                           const std::string& model_dir = {});
 
             Model(const Model&) = default;
             Model(Model&&) = default;
@@ -42,6 +45,7 @@ namespace ngraph
             const std::string& get_producer_name() const { return m_model_proto->producer_name(); }
             const ONNX_NAMESPACE::GraphProto& get_graph() const { return m_model_proto->graph(); }
             std::int64_t get_model_version() const { return m_model_proto->model_version(); }
+            const std::string& get_model_dir() const { return m_model_dir; }
             const std::string& get_producer_version() const
             {
                 return m_model_proto->producer_version();
@@ -74,6 +78,7 @@ namespace ngraph
 
         private:
             const ONNX_NAMESPACE::ModelProto* m_model_proto;
+            std::string m_model_dir;
             std::unordered_map<std::string, OperatorSet> m_opset;
         };
 
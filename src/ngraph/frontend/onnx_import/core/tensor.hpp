@@ -17,10 +17,14 @@
 #pragma once
 
 #include <onnx/onnx_pb.h>
+#include <stdexcept>
+#include <string>
 #include <utility>
 #include <vector>
 
+#include "ngraph/file_util.hpp"
 #include "ngraph/op/constant.hpp"
+#include "ngraph/runtime/mapped_buffer.hpp"
 #include "ngraph/shape.hpp"
 #include "ngraph/type/element_type.hpp"
 
@@ -90,6 +94,14 @@ namespace ngraph
                     {
                     }
                 };
+
+                struct invalid_external_data : ngraph_error
+                {
+                    explicit invalid_external_data(const std::string& message)
+                        : ngraph_error{"invalid external data: " + message}
+                    {
+                    }
+                };
             }
         }
 
@@ -384,9 +396,12 @@ namespace ngraph
             };
 
             Tensor() = delete;
-            explicit Tensor(const ONNX_NAMESPACE::TensorProto& tensor)
+            /// \param model_dir The directory that the location of external data is relative to
+            explicit Tensor(const ONNX_NAMESPACE::TensorProto& tensor,
+                            const std::string& model_dir = {})
                 : m_tensor_proto{&tensor}
                 , m_shape{std::begin(tensor.dims()), std::end(tensor.dims())}
+                , m_model_dir{model_dir}
             {
                 if (m_shape == Shape{0})
                 {
@@ -411,9 +426,20 @@ namespace ngraph
                 {
                     throw error::tensor::segments_unsupported{};
                 }
+                if (has_external_data())
+                {
+                    return get_ng_constant()->template cast_vector<T>();
+                }
                 return detail::tensor::get_data<T>(*m_tensor_proto);
             }
 
+            bool has_external_data() const
+            {
+                return m_tensor_proto->has_data_location() &&
+                       m_tensor_proto->data_location() ==
+                           ONNX_NAMESPACE::TensorProto_DataLocation_EXTERNAL;
+            }
+
             const std::string& get_name() const
             {
                 if (!m_tensor_proto->has_name())
@@ -508,8 +534,24 @@ namespace ngraph
             std::shared_ptr<ngraph::op::v0::Constant>
                 make_ng_constant(const element::Type& type) const
             {
-                auto constant =
-                    std::make_shared<ngraph::op::v0::Constant>(type, m_shape, get_data<T>());
+                std::shared_ptr<ngraph::op::v0::Constant> constant;
+                if (has_external_data())
+                {
+                    constant = make_external_ng_constant(type, sizeof(T));
+                }
+                else if (m_tensor_proto->has_raw_data() && !m_tensor_proto->has_segment() &&
+                         m_tensor_proto->raw_data().size() == shape_size(m_shape) * sizeof(T))
+                {
+                    // Raw data is already laid out as the constant's data, so it is copied
+                    // once rather than through a vector
+                    constant = std::make_shared<ngraph::op::v0::Constant>(
+                        type, m_shape, m_tensor_proto->raw_data().data());
+                }
+                else
+                {
+                    constant =
+                        std::make_shared<ngraph::op::v0::Constant>(type, m_shape, get_data<T>());
+                }
                 if (m_tensor_proto->has_name())
                 {
                     constant->set_friendly_name(get_name());
@@ -517,8 +559,103 @@ namespace ngraph
                 return constant;
             }
 
+            /// \brief A constant over the tensor's range of its external data file, which is
+            ///        memory mapped rather than read
+            std::shared_ptr<ngraph::op::v0::Constant>
+                make_external_ng_constant(const element::Type& type, size_t element_size) const
+            {
+                std::string location;
+                size_t offset = 0;
+                size_t size = shape_size(m_shape) * element_size;
+                for (const auto& entry : m_tensor_proto->external_data())
+                {
+                    if (entry.key() == "location")
+                    {
+                        location = entry.value();
+                    }
+                    else if (entry.key() == "offset")
+                    {
+                        offset = parse_external_data_size(entry.key(), entry.value());
+                    }
+                    else if (entry.key() == "length" &&
+                             parse_external_data_size(entry.key(), entry.value()) < size)
+                    {
+                        throw error::tensor::invalid_external_data{
+                            "length " + entry.value() + " is too short for the tensor's " +
+                            std::to_string(size) + " bytes"};
+                    }
+                }
+                if (location.empty())
+                {
+                    throw error::tensor::invalid_external_data{"no location given"};
+                }
+                check_external_data_location(location);
+                std::string path =
+                    m_model_dir.empty() ? location : file_util::path_join(m_model_dir, location);
+                auto data = std::make_shared<runtime::MappedBuffer>(path, offset, size);
+                if (offset % element_size != 0)
+                {
+                    // Misaligned elements are copied into an aligned buffer
+                    return std::make_shared<ngraph::op::v0::Constant>(
+                        type, m_shape, data->get_ptr());
+                }
+                return std::make_shared<ngraph::op::v0::Constant>(type, m_shape, data);
+            }
+
+            /// \brief Parses the value of an offset or length entry, which must be a decimal
+            ///        number of bytes
+            static size_t parse_external_data_size(const std::string& key,
+                                                   const std::string& value)
+            {
+                try
+                {
+                    size_t pos = 0;
+                    unsigned long long result = std::stoull(value, &pos);
+                    if (pos == value.size() && value.find('-') == std::string::npos)
+                    {
+                        return static_cast<size_t>(result);
+                    }
+                }
+                catch (const std::invalid_argument&)
+                {
+                }
+                catch (const std::out_of_range&)
+                {
+                }
+                throw error::tensor::invalid_external_data{key + " '" + value +
+                                                           "' is not a valid size"};
+            }
+
+            /// \brief Throws unless location is a relative path that stays inside the model's
+            ///        directory
+            static void check_external_data_location(const std::string& location)
+            {
+                if (location.front() == '/' || location.front() == '\\' ||
+                    (location.size() > 1 && location[1] == ':'))
+                {
+                    throw error::tensor::invalid_external_data{"location '" + location +
+                                                               "' is not a relative path"};
+                }
+                size_t begin = 0;
+                while (begin <= location.size())
+                {
+                    size_t end = location.find_first_of("/\\", begin);
+                    if (end == std::string::npos)
+                    {
+                        end = location.size();
+                    }
+                    if (location.compare(begin, end - begin, "..") == 0)
+                    {
+                        throw error::tensor::invalid_external_data{
+                            "location '" + location + "' leaves the model's directory"};
+                    }
+                    begin = end + 1;
+                }
+            }
+
             const ONNX_NAMESPACE::TensorProto* m_tensor_proto;
             Shape m_shape;
+            std::string m_model_dir;
         };
 
         inline std::ostream& operator<<(std::ostream& outs, const Tensor& tensor)
@@ -22,6 +22,7 @@
 #include "core/graph.hpp"
 #include "core/model.hpp"
 #include "ngraph/except.hpp"
+#include "ngraph/file_util.hpp"
 #include "onnx.hpp"
 #include "ops_bridge.hpp"
 
@@ -51,7 +52,8 @@ namespace ngraph
             }
         }
 
-        std::shared_ptr<Function> import_onnx_model(std::istream& stream)
+        std::shared_ptr<Function> import_onnx_model(std::istream& stream,
+                                                    const std::string& model_dir)
         {
             ONNX_NAMESPACE::ModelProto model_proto;
             // Try parsing input as a binary protobuf message
@@ -68,7 +70,7 @@ namespace ngraph
                 }
             }
 
-            Model model{model_proto};
+            Model model{model_proto, model_dir};
             Graph graph{model_proto.graph(), model};
             auto function = std::make_shared<Function>(
                 graph.get_ng_outputs(), graph.get_ng_parameters(), graph.get_name());
@@ -86,7 +88,15 @@ namespace ngraph
             {
                 throw detail::error::file_open{file_path};
             }
-            return import_onnx_model(ifs);
+            // External data is looked up relative to the model's directory. A bare file name
+            // leaves it relative to the working directory, a model in the root keeps "/".
+            std::string model_dir;
+            auto pos = file_path.find_last_of('/');
+            if (pos != std::string::npos)
+            {
+                model_dir = file_path.substr(0, pos == 0 ? 1 : pos);
+            }
+            return import_onnx_model(ifs, model_dir);
         }
 
         std::set<std::string> get_supported_operators(std::int64_t version,
@@ -63,10 +63,14 @@ namespace ngraph
         ///             the function throws an ngraph_error exception.
         ///
         /// \param[in]  stream    The input stream (e.g. file stream, memory stream, etc).
+        /// \param[in]  model_dir The directory that the locations of tensors stored in
+        ///                       external data files are relative to. The current directory
+        ///                       if empty.
         ///
         /// \return     An nGraph function that represents a single output from the created graph.
         ONNX_IMPORTER_API
-        std::shared_ptr<Function> import_onnx_model(std::istream& stream);
+        std::shared_ptr<Function> import_onnx_model(std::istream& stream,
+                                                    const std::string& model_dir = {});
 
         /// \brief     Imports and converts an ONNX model from the input file
         ///            to an nGraph Function representation.
@@ -75,7 +79,8 @@ namespace ngraph
         ///            the function throws an ngraph_error exception.
         ///
         /// \param[in] file_path  The path to a file containing the ONNX model
-        ///                       (relative or absolute).
+        ///                       (relative or absolute). External tensor data is looked up
+        ///                       relative to the directory of the file.
         ///
         /// \return    An nGraph function that represents a single output from the created graph.
         ONNX_IMPORTER_API
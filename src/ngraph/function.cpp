@@ -17,6 +17,7 @@
 #include <algorithm>
 #include <list>
 #include <memory>
+#include <mutex>
 
 #include "ngraph/function.hpp"
 #include "ngraph/graph_util.hpp"
@@ -89,17 +90,54 @@ void Function::init()
 
 NodeVector Function::get_ordered_ops() const
 {
-    NodeVector nodes;
+    vector<Node*> roots;
     for (auto& r : get_results())
     {
-        nodes.push_back(r);
+        roots.push_back(r.get());
     }
     for (auto& param : get_parameters())
     {
-        nodes.push_back(param);
+        roots.push_back(param.get());
     }
 
-    return m_topological_sorter(nodes);
+    lock_guard<mutex> guard(m_ordered_ops_mutex);
+    NodeVector result;
+    if (m_ordered_ops_valid && roots == m_ordered_ops_roots)
+    {
+        // Still valid if every node is alive and unchanged. A node can only join or leave
+        // the graph through a change to the inputs or control dependencies of another.
+        result.reserve(m_ordered_ops.size());
+        for (auto& entry : m_ordered_ops)
+        {
+            shared_ptr<Node> node = entry.first.lock();
+            if (!node || node->get_graph_version() != entry.second)
+            {
+                result.clear();
+                break;
+            }
+            result.push_back(move(node));
+        }
+        if (result.size() == m_ordered_ops.size())
+        {
+            return result;
+        }
+    }
+
+    NodeVector nodes;
+    for (Node* root : roots)
+    {
+        nodes.push_back(root->shared_from_this());
+    }
+    result = m_topological_sorter(nodes);
+    m_ordered_ops.clear();
+    m_ordered_ops.reserve(result.size());
+    for (auto& node : result)
+    {
+        m_ordered_ops.emplace_back(node, node->get_graph_version());
+    }
+    m_ordered_ops_roots = roots;
+    m_ordered_ops_valid = true;
+    return result;
 }
 
 void Function::map_unordered_ops(std::function<void(Node*)> f) const
@@ -290,5 +328,7 @@ void Function::replace_parameter(size_t parameter_index,
 
 void Function::set_topological_sort(topological_sort_t sorter)
 {
+    lock_guard<mutex> guard(m_ordered_ops_mutex);
     m_topological_sorter = sorter;
+    m_ordered_ops_valid = false;
 }
@@ -20,6 +20,7 @@
 #include <initializer_list>
 #include <list>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -90,6 +91,8 @@ namespace ngraph
         const std::string& get_friendly_name() const;
 
         NodeVector get_ops() const;
+        /// \brief Returns the ops in execution order. The order is cached and only
+        ///        recomputed after one of its nodes changes (see Node::get_graph_version).
         NodeVector get_ordered_ops() const;
         void map_unordered_ops(std::function<void(Node*)> f) const;
 
@@ -140,5 +143,12 @@ namespace ngraph
         const std::string m_unique_name;
         size_t m_placement{0};
         topological_sort_t m_topological_sorter;
+
+        mutable std::mutex m_ordered_ops_mutex;
+        // The last order computed, with the graph version of each node at the time. The
+        // references are weak so the cache does not keep nodes removed from the graph alive.
+        mutable std::vector<std::pair<std::weak_ptr<Node>, size_t>> m_ordered_ops;
+        mutable std::vector<Node*> m_ordered_ops_roots;
+        mutable bool m_ordered_ops_valid{false};
     };
 }
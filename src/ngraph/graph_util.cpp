@@ -14,11 +14,17 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <iomanip>
 #include <numeric>
+#include <sstream>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
+#include "ngraph/attribute_visitor.hpp"
 #include "ngraph/descriptor/input.hpp"
 #include "ngraph/descriptor/output.hpp"
 #include "ngraph/function.hpp"
@@ -33,6 +39,7 @@
 #include "ngraph/pass/visualize_tree.hpp"
 #include "ngraph/provenance.hpp"
 #include "ngraph/rt_info.hpp"
+#include "ngraph/serializer.hpp"
 #include "ngraph/util.hpp"
 
 using namespace std;
@@ -944,3 +951,379 @@ bool ngraph::replace_node_update_name(std::shared_ptr<Node> target,
     copy_runtime_info(target, replacement);
     return true;
 }
+
+namespace
+{
+    /// SHA-256 (FIPS 180-4) of a byte stream
+    class Sha256
+    {
+    public:
+        void update(const void* data, size_t size)
+        {
+            auto bytes = static_cast<const uint8_t*>(data);
+            m_length += size;
+            while (size > 0)
+            {
+                size_t count = min(size, sizeof(m_block) - m_block_size);
+                memcpy(m_block + m_block_size, bytes, count);
+                m_block_size += count;
+                bytes += count;
+                size -= count;
+                if (m_block_size == sizeof(m_block))
+                {
+                    compress();
+                    m_block_size = 0;
+                }
+            }
+        }
+
+        /// \brief Pads the stream and returns the digest. Nothing can be added afterwards.
+        array<uint8_t, 32> finish()
+        {
+            uint64_t bit_length = m_length * 8;
+            uint8_t padding[64] = {0x80};
+            size_t padding_size = (m_block_size < 56 ? 56 : 120) - m_block_size;
+            update(padding, padding_size);
+            uint8_t length[8];
+            for (size_t i = 0; i < 8; ++i)
+            {
+                length[i] = static_cast<uint8_t>(bit_length >> (56 - 8 * i));
+            }
+            update(length, sizeof(length));
+            array<uint8_t, 32> digest;
+            for (size_t i = 0; i < 32; ++i)
+            {
+                digest[i] = static_cast<uint8_t>(m_state[i / 4] >> (24 - 8 * (i % 4)));
+            }
+            return digest;
+        }
+
+    private:
+        static uint32_t rotr(uint32_t x, int n) { return (x >> n) | (x << (32 - n)); }
+        void compress()
+        {
+            static const uint32_t k[64] = {
+                0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1,
+                0x923f82a4, 0xab1c5ed5, 0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3,
+                0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174, 0xe49b69c1, 0xefbe4786,
+                0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+                0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147,
+                0x06ca6351, 0x14292967, 0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13,
+                0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85, 0xa2bfe8a1, 0xa81a664b,
+                0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+                0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a,
+                0x5b9cca4f, 0x682e6ff3, 0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208,
+                0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2};
+            uint32_t w[64];
+            for (size_t i = 0; i < 16; ++i)
+            {
+                w[i] = (uint32_t(m_block[4 * i]) << 24) | (uint32_t(m_block[4 * i + 1]) << 16) |
+                       (uint32_t(m_block[4 * i + 2]) << 8) | uint32_t(m_block[4 * i + 3]);
+            }
+            for (size_t i = 16; i < 64; ++i)
+            {
+                uint32_t s0 = rotr(w[i - 15], 7) ^ rotr(w[i - 15], 18) ^ (w[i - 15] >> 3);
+                uint32_t s1 = rotr(w[i - 2], 17) ^ rotr(w[i - 2], 19) ^ (w[i - 2] >> 10);
+                w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+            }
+            uint32_t a = m_state[0], b = m_state[1], c = m_state[2], d = m_state[3];
+            uint32_t e = m_state[4], f = m_state[5], g = m_state[6], h = m_state[7];
+            for (size_t i = 0; i < 64; ++i)
+            {
+                uint32_t s1 = rotr(e, 6) ^ rotr(e, 11) ^ rotr(e, 25);
+                uint32_t t1 = h + s1 + ((e & f) ^ (~e & g)) + k[i] + w[i];
+                uint32_t s0 = rotr(a, 2) ^ rotr(a, 13) ^ rotr(a, 22);
+                uint32_t t2 = s0 + ((a & b) ^ (a & c) ^ (b & c));
+                h = g;
+                g = f;
+                f = e;
+                e = d + t1;
+                d = c;
+                c = b;
+                b = a;
+                a = t1 + t2;
+            }
+            m_state[0] += a;
+            m_state[1] += b;
+            m_state[2] += c;
+            m_state[3] += d;
+            m_state[4] += e;
+            m_state[5] += f;
+            m_state[6] += g;
+            m_state[7] += h;
+        }
+
+        uint32_t m_state[8] = {0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+                               0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19};
+        uint8_t m_block[64];
+        size_t m_block_size = 0;
+        uint64_t m_length = 0;
+    };
+
+    /// SHA-256 of a canonical byte stream fed by an op's visit_attributes. Every value is
+    /// written with its size, so the stream of two different structures is never the same.
+    /// Node references are hashed by their position in the function's topological order;
+    /// anything that cannot be hashed deterministically marks the whole function as unhashable.
+    class StructuralHasher : public AttributeVisitor
+    {
+    public:
+        StructuralHasher(const unordered_map<Node*, size_t>& node_index)
+            : m_node_index(node_index)
+        {
+        }
+
+        bool is_hashable() const { return m_hashable; }
+        void set_unhashable() { m_hashable = false; }
+        void set_hashable() { m_hashable = true; }
+        void add(uint64_t value)
+        {
+            uint8_t bytes[8];
+            for (size_t i = 0; i < 8; ++i)
+            {
+                bytes[i] = static_cast<uint8_t>(value >> (8 * i));
+            }
+            m_sha.update(bytes, sizeof(bytes));
+        }
+
+        void add(const void* data, size_t size)
+        {
+            add(static_cast<uint64_t>(size));
+            m_sha.update(data, size);
+        }
+
+        void add(const string& value) { add(value.data(), value.size()); }
+        template <typename T>
+        void add_values(const string& name, const vector<T>& values)
+        {
+            add(name);
+            add(static_cast<uint64_t>(values.size()));
+            for (auto& value : values)
+            {
+                add(static_cast<uint64_t>(value));
+            }
+        }
+
+        string digest()
+        {
+            stringstream ss;
+            ss << hex << setfill('0');
+            for (uint8_t byte : m_sha.finish())
+            {
+                ss << setw(2) << static_cast<unsigned>(byte);
+            }
+            return ss.str();
+        }
+
+        void on_adapter(const string& name, ValueAccessor<void>& adapter) override
+        {
+            set_unhashable();
+        }
+        void on_adapter(const string& name, ValueAccessor<void*>& adapter) override
+        {
+            add(name);
+            add(adapter.get_ptr(), adapter.size());
+        }
+        void on_adapter(const string& name, ValueAccessor<string>& adapter) override
+        {
+            add(name);
+            add(adapter.get());
+        }
+        void on_adapter(const string& name, ValueAccessor<bool>& adapter) override
+        {
+            add_scalar(name, adapter.get());
+        }
+        void on_adapter(const string& name, ValueAccessor<int8_t>& adapter) override
+        {
+            add_scalar(name, adapter.get());
+        }
+        void on_adapter(const string& name, ValueAccessor<int16_t>& adapter) override
+        {
+            add_scalar(name, adapter.get());
+        }
+        void on_adapter(const string& name, ValueAccessor<int32_t>& adapter) override
+        {
+            add_scalar(name, adapter.get());
+        }
+        void on_adapter(const string& name, ValueAccessor<int64_t>& adapter) override
+        {
+            add_scalar(name, adapter.get());
+        }
+        void on_adapter(const string& name, ValueAccessor<uint8_t>& adapter) override
+        {
+            add_scalar(name, adapter.get());
+        }
+        void on_adapter(const string& name, ValueAccessor<uint16_t>& adapter) override
+        {
+            add_scalar(name, adapter.get());
+        }
+        void on_adapter(const string& name, ValueAccessor<uint32_t>& adapter) override
+        {
+            add_scalar(name, adapter.get());
+        }
+        void on_adapter(const string& name, ValueAccessor<uint64_t>& adapter) override
+        {
+            add_scalar(name, adapter.get());
+        }
+        void on_adapter(const string& name, ValueAccessor<float>& adapter) override
+        {
+            add(name);
+            float value = adapter.get();
+            add(&value, sizeof(value));
+        }
+        void on_adapter(const string& name, ValueAccessor<double>& adapter) override
+        {
+            add(name);
+            double value = adapter.get();
+            add(&value, sizeof(value));
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<int8_t>>& adapter) override
+        {
+            add_values(name, adapter.get());
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<int16_t>>& adapter) override
+        {
+            add_values(name, adapter.get());
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<int32_t>>& adapter) override
+        {
+            add_values(name, adapter.get());
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<int64_t>>& adapter) override
+        {
+            add_values(name, adapter.get());
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<uint8_t>>& adapter) override
+        {
+            add_values(name, adapter.get());
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<uint16_t>>& adapter) override
+        {
+            add_values(name, adapter.get());
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<uint32_t>>& adapter) override
+        {
+            add_values(name, adapter.get());
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<uint64_t>>& adapter) override
+        {
+            add_values(name, adapter.get());
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<float>>& adapter) override
+        {
+            add(name);
+            auto& values = adapter.get();
+            add(values.data(), values.size() * sizeof(float));
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<double>>& adapter) override
+        {
+            add(name);
+            auto& values = adapter.get();
+            add(values.data(), values.size() * sizeof(double));
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<string>>& adapter) override
+        {
+            add(name);
+            auto& values = adapter.get();
+            add(static_cast<uint64_t>(values.size()));
+            for (auto& value : values)
+            {
+                add(value);
+            }
+        }
+
+        void register_node(const shared_ptr<Node>& node, node_id_t id) override {}
+        shared_ptr<Node> get_registered_node(node_id_t id) override
+        {
+            set_unhashable();
+            return nullptr;
+        }
+        node_id_t get_registered_node_id(const shared_ptr<Node>& node) override
+        {
+            auto it = m_node_index.find(node.get());
+            if (it == m_node_index.end())
+            {
+                // References outside the function, e.g. into a sub-graph body
+                set_unhashable();
+                return invalid_node_id;
+            }
+            return to_string(it->second);
+        }
+
+    private:
+        template <typename T>
+        void add_scalar(const string& name, T value)
+        {
+            add(name);
+            add(static_cast<uint64_t>(value));
+        }
+
+        const unordered_map<Node*, size_t>& m_node_index;
+        Sha256 m_sha;
+        bool m_hashable{true};
+    };
+}
+
+string ngraph::structural_hash(const Function& func)
+{
+    NodeVector ops = func.get_ordered_ops();
+    unordered_map<Node*, size_t> node_index;
+    for (size_t i = 0; i < ops.size(); ++i)
+    {
+        node_index[ops[i].get()] = i;
+    }
+
+    StructuralHasher hasher(node_index);
+    for (auto& node : ops)
+    {
+        auto& type_info = node->get_type_info();
+        hasher.add(type_info.name);
+        hasher.add(type_info.version);
+        hasher.add(static_cast<uint64_t>(node->get_input_size()));
+        for (auto& input : node->inputs())
+        {
+            auto source = input.get_source_output();
+            hasher.add(static_cast<uint64_t>(node_index.at(source.get_node())));
+            hasher.add(static_cast<uint64_t>(source.get_index()));
+        }
+        auto& control_deps = node->get_control_dependencies();
+        hasher.add(static_cast<uint64_t>(control_deps.size()));
+        for (auto& dep : control_deps)
+        {
+            auto it = node_index.find(dep.get());
+            if (it == node_index.end())
+            {
+                return "";
+            }
+            hasher.add(static_cast<uint64_t>(it->second));
+        }
+        hasher.add(static_cast<uint64_t>(node->get_output_size()));
+        for (auto& output : node->outputs())
+        {
+            hasher.add(output.get_element_type().get_type_name());
+            stringstream shape;
+            shape << output.get_partial_shape();
+            hasher.add(shape.str());
+        }
+        if (!node->visit_attributes(hasher) || !hasher.is_hashable())
+        {
+            // Ops without an attribute visitor, such as most v0 ops, are hashed by what the
+            // serializer writes for them
+            string attributes = serialize_node_attributes(*node);
+            if (attributes.empty())
+            {
+                return "";
+            }
+            hasher.set_hashable();
+            hasher.add(attributes);
+        }
+    }
+    for (auto& parameter : func.get_parameters())
+    {
+        hasher.add(static_cast<uint64_t>(node_index.at(parameter.get())));
+    }
+    for (auto& result : func.get_results())
+    {
+        hasher.add(static_cast<uint64_t>(node_index.at(result.get())));
+    }
+    return hasher.digest();
+}
@@ -506,4 +506,18 @@ namespace ngraph
 
     NGRAPH_API
     bool replace_node_update_name(std::shared_ptr<Node> target, std::shared_ptr<Node> replacement);
+
+    /// \brief Computes a SHA-256 digest of the structure of a function.
+    ///
+    /// The digest covers op types and versions, attributes (including constant values), input
+    /// connections, control dependencies, output element types and shapes, and the order of the
+    /// parameters and results. Node names are not included, so two independently built copies of
+    /// the same graph have the same digest.
+    ///
+    /// \param func The function to hash.
+    /// \return The digest as 64 hex digits, or an empty string if some op in the function
+    ///         cannot be hashed because neither visit_attributes nor the serializer expose its
+    ///         attributes.
+    NGRAPH_API
+    std::string structural_hash(const Function& func);
 }
@@ -0,0 +1,242 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <cstring>
+
+#include "ngraph/check.hpp"
+#include "ngraph/except.hpp"
+#include "ngraph/model_file.hpp"
+#include "ngraph/runtime/mapped_buffer.hpp"
+#include "ngraph/runtime/shared_buffer.hpp"
+
+using namespace ngraph;
+using namespace std;
+
+static const char s_magic[8] = {'N', 'G', 'R', 'A', 'P', 'H', 'M', 'F'};
+static const uint32_t s_version = 1;
+static const size_t s_header_size = 16;
+static const size_t s_trailer_size = 16;
+
+static void write_u32(ostream& out, uint32_t value)
+{
+    char bytes[4];
+    for (size_t i = 0; i < 4; ++i)
+    {
+        bytes[i] = static_cast<char>(value >> (8 * i));
+    }
+    out.write(bytes, 4);
+}
+
+static void write_u64(ostream& out, uint64_t value)
+{
+    char bytes[8];
+    for (size_t i = 0; i < 8; ++i)
+    {
+        bytes[i] = static_cast<char>(value >> (8 * i));
+    }
+    out.write(bytes, 8);
+}
+
+static uint64_t read_u64(const char* data, size_t bytes = 8)
+{
+    uint64_t value = 0;
+    for (size_t i = 0; i < bytes; ++i)
+    {
+        value |= static_cast<uint64_t>(static_cast<uint8_t>(data[i])) << (8 * i);
+    }
+    return value;
+}
+
+bool model_file::is_model_file(const string& path)
+{
+    ifstream in(path, ios_base::binary | ios_base::in);
+    return in && is_model_file(in);
+}
+
+bool model_file::is_model_file(istream& in)
+{
+    auto offset = in.tellg();
+    char magic[sizeof(s_magic)];
+    in.read(magic, sizeof(magic));
+    bool rc = in.gcount() == sizeof(magic) && memcmp(magic, s_magic, sizeof(magic)) == 0;
+    in.clear();
+    in.seekg(offset, ios_base::beg);
+    return rc;
+}
+
+model_file::Writer::Writer(ostream& out)
+    : m_stream(&out)
+{
+    write_header();
+}
+
+model_file::Writer::Writer(const string& filename)
+    : m_stream(&m_my_stream)
+{
+    m_my_stream.open(filename, ios_base::binary | ios_base::out);
+    if (!m_my_stream)
+    {
+        throw ngraph_error("Unable to create model file '" + filename + "'");
+    }
+    write_header();
+}
+
+model_file::Writer::~Writer()
+{
+    close();
+}
+
+void model_file::Writer::write_header()
+{
+    m_stream->write(s_magic, sizeof(s_magic));
+    write_u32(*m_stream, s_version);
+    write_u32(*m_stream, static_cast<uint32_t>(alignment));
+    m_offset = s_header_size;
+    pad();
+}
+
+void model_file::Writer::pad()
+{
+    static const char zeros[alignment] = {};
+    size_t padding = (alignment - m_offset % alignment) % alignment;
+    m_stream->write(zeros, padding);
+    m_offset += padding;
+}
+
+void model_file::Writer::write(const string& name, const void* data, size_t size_in_bytes)
+{
+    NGRAPH_CHECK(!m_closed, "Model file entry '", name, "' written after close");
+    m_entries.push_back({name, m_offset, size_in_bytes});
+    m_stream->write(static_cast<const char*>(data), size_in_bytes);
+    m_offset += size_in_bytes;
+    pad();
+}
+
+void model_file::Writer::close()
+{
+    if (m_closed)
+    {
+        return;
+    }
+    m_closed = true;
+    uint64_t index_offset = m_offset;
+    for (const Entry& entry : m_entries)
+    {
+        write_u64(*m_stream, entry.m_offset);
+        write_u64(*m_stream, entry.m_size);
+        write_u64(*m_stream, entry.m_name.size());
+        m_stream->write(entry.m_name.data(), entry.m_name.size());
+    }
+    write_u64(*m_stream, index_offset);
+    write_u64(*m_stream, m_entries.size());
+    m_stream->flush();
+    if (m_my_stream.is_open())
+    {
+        m_my_stream.close();
+    }
+}
+
+model_file::Reader::Reader(const string& filename)
+    : m_file(make_shared<runtime::MappedBuffer>(filename))
+{
+    read_index();
+}
+
+model_file::Reader::Reader(istream& in)
+{
+    read(in);
+    read_index();
+}
+
+void model_file::Reader::read(istream& in)
+{
+    auto begin = in.tellg();
+    in.seekg(0, ios_base::end);
+    auto end = in.tellg();
+    in.seekg(begin, ios_base::beg);
+    NGRAPH_CHECK(begin != -1 && end != -1, "Model files can only be read from seekable streams");
+    size_t size = static_cast<size_t>(end - begin);
+    m_file = make_shared<runtime::AlignedBuffer>(size, alignment);
+    in.read(m_file->get_ptr<char>(), size);
+    NGRAPH_CHECK(static_cast<size_t>(in.gcount()) == size, "Model file is truncated");
+}
+
+void model_file::Reader::read_index()
+{
+    const char* data = m_file->get_ptr<char>();
+    size_t size = m_file->size();
+    NGRAPH_CHECK(size >= s_header_size + s_trailer_size &&
+                     memcmp(data, s_magic, sizeof(s_magic)) == 0,
+                 "Invalid model file");
+    uint64_t version = read_u64(data + sizeof(s_magic), 4);
+    NGRAPH_CHECK(version == s_version, "Unsupported model file version ", version);
+
+    uint64_t index_offset = read_u64(data + size - s_trailer_size);
+    uint64_t entry_count = read_u64(data + size - s_trailer_size + 8);
+    NGRAPH_CHECK(index_offset >= s_header_size && index_offset <= size - s_trailer_size,
+                 "Invalid model file index");
+    const char* index = data + index_offset;
+    const char* index_end = data + size - s_trailer_size;
+    // Each entry takes at least 24 bytes, which bounds the count before anything is reserved
+    NGRAPH_CHECK(entry_count <= static_cast<uint64_t>(index_end - index) / 24,
+                 "Invalid model file index: ",
+                 entry_count,
+                 " entries do not fit in ",
+                 index_end - index,
+                 " bytes");
+    m_names.reserve(entry_count);
+    m_offsets.reserve(entry_count);
+    m_sizes.reserve(entry_count);
+    for (uint64_t i = 0; i < entry_count; ++i)
+    {
+        NGRAPH_CHECK(index_end - index >= 24, "Invalid model file index");
+        uint64_t offset = read_u64(index);
+        uint64_t entry_size = read_u64(index + 8);
+        uint64_t name_size = read_u64(index + 16);
+        index += 24;
+        NGRAPH_CHECK(offset <= index_offset && entry_size <= index_offset - offset &&
+                         name_size <= static_cast<uint64_t>(index_end - index),
+                     "Invalid model file entry ",
+                     i);
+        m_names.emplace_back(index, name_size);
+        m_offsets.push_back(offset);
+        m_sizes.push_back(entry_size);
+        m_index.emplace(m_names.back(), m_names.size() - 1);
+        index += name_size;
+    }
+}
+
+size_t model_file::Reader::find(const string& name) const
+{
+    auto it = m_index.find(name);
+    return it == m_index.end() ? get_entry_count() : it->second;
+}
+
+size_t model_file::Reader::get_size(size_t index) const
+{
+    return m_sizes.at(index);
+}
+
+const char* model_file::Reader::get_data(size_t index) const
+{
+    return m_file->get_ptr<char>() + m_offsets.at(index);
+}
+
+shared_ptr<runtime::AlignedBuffer> model_file::Reader::get_buffer(size_t index) const
+{
+    return make_shared<runtime::SharedBuffer<shared_ptr<runtime::AlignedBuffer>>>(
+        const_cast<char*>(get_data(index)), get_size(index), m_file);
+}
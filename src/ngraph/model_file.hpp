@@ -0,0 +1,115 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "ngraph/ngraph_visibility.hpp"
+#include "ngraph/runtime/aligned_buffer.hpp"
+
+// A model file is a set of named binary entries laid out so that it can be memory mapped.
+//
+//   header   8 byte magic "NGRAPHMF", u32 version, u32 alignment, padded to the alignment
+//   entries  the data of each entry, each starting at a multiple of the alignment
+//   index    for each entry u64 offset, u64 size, u64 name size and the name
+//   trailer  u64 offset of the index, u64 number of entries
+//
+// All integers are little endian. Offsets and sizes are 64 bit, so entries may be larger
+// than 4GB.
+
+namespace ngraph
+{
+    namespace model_file
+    {
+        class Writer;
+        class Reader;
+
+        /// \brief Alignment of the entries written by Writer
+        constexpr size_t alignment = 64;
+
+        NGRAPH_API
+        bool is_model_file(const std::string& path);
+        NGRAPH_API
+        bool is_model_file(std::istream& in);
+    }
+}
+
+class NGRAPH_API ngraph::model_file::Writer
+{
+public:
+    Writer(std::ostream& out);
+    Writer(const std::string& filename);
+    ~Writer();
+
+    /// \brief Append an entry. Names must be unique.
+    void write(const std::string& name, const void* data, size_t size_in_bytes);
+    /// \brief Write the index. Called by the destructor if not called before.
+    void close();
+
+private:
+    struct Entry
+    {
+        std::string m_name;
+        uint64_t m_offset;
+        uint64_t m_size;
+    };
+
+    void write_header();
+    void pad();
+
+    std::ostream* m_stream;
+    std::ofstream m_my_stream;
+    std::vector<Entry> m_entries;
+    uint64_t m_offset = 0;
+    bool m_closed = false;
+};
+
+/// \brief Reads a model file. The entries can be handed out as buffers that reference the
+/// file's memory, so their data is never copied.
+class NGRAPH_API ngraph::model_file::Reader
+{
+public:
+    /// \brief Memory map the file at \p filename, see runtime::MappedBuffer
+    Reader(const std::string& filename);
+    /// \brief Read the whole of \p in into memory
+    Reader(std::istream& in);
+
+    size_t get_entry_count() const { return m_names.size(); }
+    const std::string& get_name(size_t index) const { return m_names.at(index); }
+    /// \return The index of the entry \p name, or get_entry_count() if there is none
+    size_t find(const std::string& name) const;
+    size_t get_size(size_t index) const;
+    const char* get_data(size_t index) const;
+    /// \brief A buffer over the data of entry \p index that keeps the file alive
+    std::shared_ptr<runtime::AlignedBuffer> get_buffer(size_t index) const;
+
+private:
+    void read(std::istream& in);
+    void read_index();
+
+    std::shared_ptr<runtime::AlignedBuffer> m_file;
+    std::vector<std::string> m_names;
+    std::vector<uint64_t> m_offsets;
+    std::vector<uint64_t> m_sizes;
+    std::unordered_map<std::string, size_t> m_index;
+};
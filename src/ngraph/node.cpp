@@ -15,6 +15,7 @@
 //*****************************************************************************
 
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <typeindex>
 #include <typeinfo>
@@ -35,6 +36,18 @@ using namespace ngraph;
 
 atomic<size_t> Node::m_next_instance_id(0);
 
+namespace
+{
+    // Never destroyed, since nodes may outlive static destructors
+    const string& intern_type_name(const char* type_name)
+    {
+        static mutex* names_mutex = new mutex();
+        static unordered_set<string>* names = new unordered_set<string>();
+        lock_guard<mutex> lock(*names_mutex);
+        return *names->insert(type_name).first;
+    }
+}
+
 Node::Node(size_t output_size)
     : Node()
 {
@@ -136,6 +149,7 @@ void Node::safe_delete(NodeVector& nodes, bool recurse)
 void Node::set_arguments(const OutputVector& arguments)
 {
     // Add this node as a user of each argument.
+    m_inputs.reserve(m_inputs.size() + arguments.size());
     size_t i = 0;
     for (auto& output : arguments)
     {
@@ -196,6 +210,7 @@ void Node::delayed_validate_and_infer_types()
 void Node::set_output_size(size_t n)
 {
     NGRAPH_CHECK(n >= m_outputs.size(), "shrinking ", m_outputs.size(), " to ", n);
+    m_outputs.reserve(n);
     for (size_t i = m_outputs.size(); i < n; ++i)
     {
         // create the descriptors
@@ -240,10 +255,16 @@ bool Node::is_constant() const
 
 const std::string& Node::description() const
 {
-    // Terrible transitional kludge to keep description working while we change
-    // type_name to const_char and virtual description() to virtual get_type_name()
-    const_cast<Node*>(this)->m_node_type = get_type_name();
-    return m_node_type;
+    // All nodes of a type share one copy of its name. The type name is checked again since
+    // it changes while the bases of a node are constructed.
+    const char* type_name = get_type_name();
+    const string* node_type = m_node_type.load(memory_order_acquire);
+    if (node_type == nullptr || *node_type != type_name)
+    {
+        node_type = &intern_type_name(type_name);
+        m_node_type.store(node_type, memory_order_release);
+    }
+    return *node_type;
 }
 
 const std::string& Node::get_friendly_name() const
@@ -279,14 +300,36 @@ void Node::set_placement(int32_t placement)
     m_placement = placement;
 }
 
+Node::RTMap& Node::get_rt_info()
+{
+    if (!m_rt_info)
+    {
+        m_rt_info.reset(new RTMap());
+    }
+    return *m_rt_info;
+}
+
+const Node::RTMap& Node::get_rt_info() const
+{
+    static const RTMap empty;
+    return m_rt_info ? *m_rt_info : empty;
+}
+
 void Node::add_provenance_group_member(const shared_ptr<Node>& node)
 {
-    m_provenance_group.insert(node);
+    if (!m_provenance_group)
+    {
+        m_provenance_group.reset(new set<shared_ptr<Node>>());
+    }
+    m_provenance_group->insert(node);
 }
 
 void Node::remove_provenance_group_member(const shared_ptr<Node>& node)
 {
-    m_provenance_group.erase(node);
+    if (m_provenance_group)
+    {
+        m_provenance_group->erase(node);
+    }
 }
 
 void Node::replace_provenance_group_member(const shared_ptr<Node>& current_node,
@@ -305,7 +348,8 @@ void Node::replace_provenance_group_member(const shared_ptr<Node>& current_node,
 
 const set<shared_ptr<Node>>& Node::get_provenance_group_members() const
 {
-    return m_provenance_group;
+    static const set<shared_ptr<Node>> empty;
+    return m_provenance_group ? *m_provenance_group : empty;
 }
 
 shared_ptr<Node> Node::add_provenance_group_members_above(const OutputVector& base)
@@ -337,7 +381,7 @@ shared_ptr<Node> Node::add_provenance_group_members_above(const OutputVector& ba
         add_provenance_group_member(node->shared_from_this());
         for (auto value : node->input_values())
         {
-            if (m_provenance_group.count(value.get_node_shared_ptr()) == 0)
+            if (m_provenance_group->count(value.get_node_shared_ptr()) == 0)
             {
                 todo.push_back(value.get_node());
             }
@@ -375,21 +419,32 @@ void Node::add_provenance_tags_above(const OutputVector& base,
 
 const std::unordered_set<std::string>& Node::get_provenance_tags() const
 {
-    return m_provenance_tags;
+    static const unordered_set<string> empty;
+    return m_provenance_tags ? *m_provenance_tags : empty;
 }
 
 void Node::add_provenance_tag(const std::string& tag)
 {
-    m_provenance_tags.insert(tag);
-    for (auto node : m_provenance_group)
+    if (!m_provenance_tags)
     {
-        node->add_provenance_tag(tag);
+        m_provenance_tags.reset(new unordered_set<string>());
+    }
+    m_provenance_tags->insert(tag);
+    if (m_provenance_group)
+    {
+        for (auto node : *m_provenance_group)
+        {
+            node->add_provenance_tag(tag);
+        }
     }
 }
 
 void Node::remove_provenance_tag(const std::string& tag)
 {
-    m_provenance_tags.erase(tag);
+    if (m_provenance_tags)
+    {
+        m_provenance_tags->erase(tag);
+    }
 }
 
 void Node::merge_provenance_tags_from(const std::shared_ptr<const Node>& source)
@@ -477,6 +532,7 @@ void Node::add_control_dependency(std::shared_ptr<Node> node)
         m_control_dependencies.end())
     {
         m_control_dependencies.push_back(node);
+        graph_changed();
         if (find(node->m_control_dependents.begin(), node->m_control_dependents.end(), this) ==
             node->m_control_dependents.end())
         {
@@ -514,6 +570,7 @@ void Node::remove_control_dependency(std::shared_ptr<Node> node)
         if (it != m_control_dependencies.end())
         {
             m_control_dependencies.erase(it);
+            graph_changed();
         }
     }
     {
@@ -536,6 +593,7 @@ void Node::clear_control_dependencies()
         }
     }
     m_control_dependencies.clear();
+    graph_changed();
 }
 
 void Node::clear_control_dependents()
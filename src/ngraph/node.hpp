@@ -290,6 +290,12 @@ namespace ngraph
         virtual bool is_dynamic() const;
         virtual bool has_state() const { return false; }
         size_t get_instance_id() const { return m_instance_id; }
+
+        /// \brief Returns a counter that changes whenever an input of this node is connected,
+        ///        rewired or disconnected, or one of its control dependencies is added or
+        ///        removed. A cached ordering of a graph is valid while the versions of all of
+        ///        its nodes are unchanged.
+        size_t get_graph_version() const { return m_graph_version; }
         /// \brief Writes a description of a node to a stream
         /// \param os The stream; should be returned
         /// \param depth How many levels of inputs to describe
@@ -415,8 +421,8 @@ namespace ngraph
 
         using RTMap = std::map<std::string, std::shared_ptr<Variant>>;
 
-        RTMap& get_rt_info() { return m_rt_info; }
-        const RTMap& get_rt_info() const { return m_rt_info; }
+        RTMap& get_rt_info();
+        const RTMap& get_rt_info() const;
         const std::unordered_set<std::string>& get_provenance_tags() const;
         void add_provenance_tag(const std::string& tag);
         template <typename T>
@@ -510,24 +516,29 @@ namespace ngraph
         virtual bool match_node(pattern::Matcher* matcher, const Output<Node>& graph_value);
 
     private:
+        void graph_changed() { ++m_graph_version; }
         descriptor::Input& get_input_descriptor(size_t position);
         descriptor::Output& get_output_descriptor(size_t position);
 
         std::vector<Node*> m_control_dependents;
         NodeVector m_control_dependencies;
-        std::string m_node_type;
+        // Points into a table shared by all nodes, see description()
+        mutable std::atomic<const std::string*> m_node_type{nullptr};
         size_t m_instance_id{m_next_instance_id.fetch_add(1)};
         std::string m_friendly_name;
         std::string m_unique_name;
         static std::atomic<size_t> m_next_instance_id;
-        std::unordered_set<std::string> m_provenance_tags;
-        std::set<std::shared_ptr<Node>> m_provenance_group;
-        std::deque<descriptor::Input> m_inputs;
-        std::deque<descriptor::Output> m_outputs;
-        std::unordered_map<Node*, autodiff::Adjoints> m_adjoint_map;
+        size_t m_graph_version{0};
+        // Descriptors fix up the pointers between inputs and outputs when they are moved, so
+        // these can grow
+        std::vector<descriptor::Input> m_inputs;
+        std::vector<descriptor::Output> m_outputs;
         int32_t m_placement = default_placement;
         std::shared_ptr<ngraph::op::util::OpAnnotations> m_op_annotations;
-        std::map<std::string, std::shared_ptr<Variant>> m_rt_info;
+        // Most nodes have no provenance or runtime info, so these are allocated on first use
+        std::unique_ptr<std::unordered_set<std::string>> m_provenance_tags;
+        std::unique_ptr<std::set<std::shared_ptr<Node>>> m_provenance_group;
+        std::unique_ptr<RTMap> m_rt_info;
     };
 
     using NodeTypeInfo = Node::type_info_t;
@@ -295,10 +295,30 @@ op::v0::Constant::Constant(const element::Type& type, const Shape& shape, const
     m_all_elements_bitwise_identical = are_all_data_elements_bitwise_identical();
 }
 
+op::v0::Constant::Constant(const element::Type& type,
+                           const Shape& shape,
+                           const shared_ptr<runtime::AlignedBuffer>& data)
+    : m_element_type(type)
+    , m_shape(shape)
+    , m_data(data)
+{
+    size_t size = ceil(shape_size(m_shape) * m_element_type.bitwidth() / 8.f);
+    NGRAPH_CHECK(m_data && m_data->size() >= size,
+                 "Constant buffer of ",
+                 (m_data ? m_data->size() : 0),
+                 " bytes is too small for a ",
+                 m_element_type,
+                 " constant of shape ",
+                 m_shape);
+    constructor_validate_and_infer_types();
+    m_all_elements_bitwise_identical = are_all_data_elements_bitwise_identical();
+}
+
 op::v0::Constant::Constant(const Constant& other)
-    : Constant(other.m_element_type, other.m_shape)
+    : m_element_type(other.m_element_type)
+    , m_shape(other.m_shape)
+    , m_data(other.m_data)
 {
-    m_data = other.m_data;
     m_all_elements_bitwise_identical = other.m_all_elements_bitwise_identical;
     constructor_validate_and_infer_types();
 }
@@ -233,6 +233,20 @@ namespace ngraph
                 /// \param data A void* to constant data.
                 Constant(const element::Type& type, const Shape& shape, const void* data);
 
+                /// \brief Constructs a tensor constant that references the data of \p data
+                ///        without copying it, such as the data of a memory mapped model file
+                ///
+                /// Memory owned by something else, such as a weight pool or a protobuf message,
+                /// can be wrapped in a runtime::SharedBuffer that holds a reference to its owner.
+                /// Constants are immutable, so the buffer is never written to and can be shared.
+                ///
+                /// \param type The element type of the tensor constant.
+                /// \param shape The shape of the tensor constant.
+                /// \param data A buffer holding at least the constant's data.
+                Constant(const element::Type& type,
+                         const Shape& shape,
+                         const std::shared_ptr<runtime::AlignedBuffer>& data);
+
                 Constant(const Constant& other);
                 Constant& operator=(const Constant&) = delete;
 
@@ -458,6 +472,8 @@ namespace ngraph
                 /// \brief Allocate a buffer and return a pointer to it
                 void* allocate_buffer();
 
+                /// \brief Writable data, only used by constructors while the buffer is still
+                ///        owned by this constant alone
                 void* get_data_ptr_nc() { return (m_data ? m_data->get_ptr() : nullptr); }
                 template <element::Type_t ET>
                 typename element_type_traits<ET>::value_type* get_data_ptr_nc()
@@ -17,12 +17,14 @@
 #include <algorithm>
 #include <iostream>
 #include <regex>
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
 #include "graph_rewrite.hpp"
 #include "ngraph/env_util.hpp"
 #include "ngraph/log.hpp"
+#include "ngraph/pattern/op/pattern.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -79,14 +81,45 @@ bool pass::GraphRewrite::run_on_function(shared_ptr<Function> f)
         // that need multiple passes. See comments above.
         vector<MatchClosure> matchers_to_run{m_matchers};
         m_matchers.clear();
+        // Index the matchers by the type of their pattern root so each node is only tried
+        // against matchers that can match it, still in registration order
+        unordered_map<NodeTypeInfo, vector<size_t>> typed_matchers;
+        vector<size_t> untyped_matchers;
+        for (size_t i = 0; i < matchers_to_run.size(); ++i)
+        {
+            if (matchers_to_run[i].root_type)
+            {
+                typed_matchers[*matchers_to_run[i].root_type].push_back(i);
+            }
+            else
+            {
+                untyped_matchers.push_back(i);
+            }
+        }
+        vector<size_t> candidates;
         for (auto node : f->get_ordered_ops())
         {
             if (m_enable_shape_inference)
             {
                 node->revalidate_and_infer_types();
             }
-            for (auto& closure : matchers_to_run)
+            auto typed = typed_matchers.find(node->get_type_info());
+            if (typed == typed_matchers.end())
+            {
+                candidates = untyped_matchers;
+            }
+            else
+            {
+                candidates.clear();
+                merge(typed->second.begin(),
+                      typed->second.end(),
+                      untyped_matchers.begin(),
+                      untyped_matchers.end(),
+                      back_inserter(candidates));
+            }
+            for (size_t candidate : candidates)
             {
+                auto& closure = matchers_to_run[candidate];
                 if (is_dyn_func && closure.property[PassProperty::REQUIRE_STATIC_SHAPE])
                 {
                     NGRAPH_DEBUG << "matcher callback requires static shape but the "
@@ -149,11 +182,12 @@ bool pass::GraphRewriteBase::is_enabled(const std::string& name) const
 
 void pass::GraphRewriteBase::add_handler(const std::string& name,
                                          function<bool(const std::shared_ptr<Node>&)> handler,
-                                         const PassPropertyMask& property)
+                                         const PassPropertyMask& property,
+                                         const NodeTypeInfo* root_type)
 {
     if (is_enabled(name))
     {
-        m_matchers.push_back({name, handler, property});
+        m_matchers.push_back({name, handler, property, root_type});
         // If any matcher call back may change dynamic state, we need to
         // update the pass property.
         if (property.is_set(PassProperty::CHANGE_DYNAMIC_STATE))
@@ -163,6 +197,14 @@ void pass::GraphRewriteBase::add_handler(const std::string& name,
     }
 }
 
+// A concrete op at the pattern root only matches graph nodes of exactly its type (see
+// Node::match_node); pattern ops such as Label, Any or Or can match anything
+static const NodeTypeInfo* get_root_type(const shared_ptr<pattern::Matcher>& m)
+{
+    auto root = m->get_pattern_value().get_node_shared_ptr();
+    return dynamic_pointer_cast<pattern::op::Pattern>(root) ? nullptr : &root->get_type_info();
+}
+
 void pass::GraphRewrite::add_matcher(const shared_ptr<pattern::Matcher>& m,
                                      const graph_rewrite_callback& callback,
                                      const PassPropertyMask& property)
@@ -177,7 +219,8 @@ void pass::GraphRewrite::add_matcher(const shared_ptr<pattern::Matcher>& m,
                     }
                     return false;
                 },
-                property);
+                property,
+                get_root_type(m));
 }
 
 void pass::GraphRewrite::add_matcher(const shared_ptr<pattern::Matcher>& m,
@@ -44,9 +44,11 @@ public:
     /// \param name The name of the handler
     /// \param handler Function responsible for deciding if the graph should be changed and making
     /// the changes. Returns true if changes are made.
+    /// \param root_type If set, the handler is only called on nodes of exactly this type
     void add_handler(const std::string& name,
                      std::function<bool(const std::shared_ptr<Node>& node)> handler,
-                     const PassPropertyMask& property);
+                     const PassPropertyMask& property,
+                     const NodeTypeInfo* root_type = nullptr);
 
 protected:
     GraphRewriteBase()
@@ -65,6 +67,9 @@ protected:
         std::string name;
         std::function<bool(const std::shared_ptr<Node>& node)> handler;
         PassPropertyMask property;
+        // Type of the pattern root, or nullptr if the root is a pattern op that can match
+        // any node
+        const NodeTypeInfo* root_type;
     };
     std::vector<MatchClosure> m_matchers;
 };
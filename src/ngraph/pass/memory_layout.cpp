@@ -14,8 +14,12 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
 #include <exception>
+#include <map>
+#include <numeric>
 #include <sstream>
+#include <unordered_map>
 
 #include "ngraph/log.hpp"
 #include "ngraph/op/concat.hpp"
@@ -28,9 +32,12 @@
 using namespace std;
 using namespace ngraph;
 
-pass::MemoryLayout::MemoryLayout(size_t alignment, bool disable_memory_sharing)
+pass::MemoryLayout::MemoryLayout(size_t alignment,
+                                 bool disable_memory_sharing,
+                                 bool greedy_by_size)
     : m_alignment(alignment)
     , m_disable_memory_sharing(disable_memory_sharing)
+    , m_greedy_by_size(greedy_by_size)
 {
     if (m_alignment == 0)
     {
@@ -38,11 +45,96 @@ pass::MemoryLayout::MemoryLayout(size_t alignment, bool disable_memory_sharing)
     }
 }
 
+namespace
+{
+    // A range of pool memory used from the step that defines its first tensor through the
+    // step that frees its last one. Outputs computed in place join the block of their input.
+    struct LiveBlock
+    {
+        size_t m_size;
+        size_t m_begin;
+        size_t m_end;
+        size_t m_offset;
+        vector<descriptor::Tensor*> m_tensors;
+    };
+
+    // Greedy by size: place blocks largest first, each at the lowest offset that does not
+    // overlap a placed block whose lifetime intersects its own. Placed lifetimes are indexed
+    // by a segment tree over the steps (blocks live at a step) and by first step, so only the
+    // conflicting blocks are visited. Returns the pool size.
+    size_t assign_greedy_by_size(vector<LiveBlock>& blocks, size_t step_count)
+    {
+        vector<size_t> order(blocks.size());
+        iota(order.begin(), order.end(), 0);
+        stable_sort(order.begin(), order.end(), [&blocks](size_t a, size_t b) {
+            return blocks[a].m_size > blocks[b].m_size;
+        });
+
+        vector<vector<size_t>> live_at(2 * step_count);
+        multimap<size_t, size_t> by_begin;
+        size_t pool_size = 0;
+        vector<pair<size_t, size_t>> conflicts;
+        for (size_t index : order)
+        {
+            LiveBlock& block = blocks[index];
+            conflicts.clear();
+            // Placed blocks overlap this one if they are live at its first step or start
+            // during its lifetime
+            for (size_t p = block.m_begin + step_count; p > 0; p >>= 1)
+            {
+                for (size_t other : live_at[p])
+                {
+                    conflicts.emplace_back(blocks[other].m_offset, blocks[other].m_size);
+                }
+            }
+            for (auto it = by_begin.upper_bound(block.m_begin);
+                 it != by_begin.end() && it->first <= block.m_end;
+                 ++it)
+            {
+                conflicts.emplace_back(blocks[it->second].m_offset, blocks[it->second].m_size);
+            }
+            sort(conflicts.begin(), conflicts.end());
+
+            size_t offset = 0;
+            for (auto& conflict : conflicts)
+            {
+                if (offset + block.m_size <= conflict.first)
+                {
+                    break;
+                }
+                offset = max(offset, conflict.first + conflict.second);
+            }
+            block.m_offset = offset;
+            pool_size = max(pool_size, offset + block.m_size);
+
+            for (size_t l = block.m_begin + step_count, r = block.m_end + step_count + 1; l < r;
+                 l >>= 1, r >>= 1)
+            {
+                if (l & 1)
+                {
+                    live_at[l++].push_back(index);
+                }
+                if (r & 1)
+                {
+                    live_at[--r].push_back(index);
+                }
+            }
+            by_begin.insert({block.m_begin, index});
+        }
+        return pool_size;
+    }
+}
+
 bool pass::MemoryLayout::run_on_function(shared_ptr<Function> function)
 {
     MemoryManager mm(m_alignment, m_disable_memory_sharing);
-    for (shared_ptr<Node> node : function->get_ordered_ops())
+    bool greedy_by_size = m_greedy_by_size && !m_disable_memory_sharing;
+    vector<LiveBlock> blocks;
+    unordered_map<const descriptor::Tensor*, size_t> tensor_block;
+    auto ops = function->get_ordered_ops();
+    for (size_t step = 0; step < ops.size(); ++step)
     {
+        shared_ptr<Node> node = ops[step];
         std::map<descriptor::Tensor*, descriptor::Tensor*> in_place_outputs;
         std::set<const descriptor::Tensor*> reused_inputs;
 
@@ -80,6 +172,26 @@ bool pass::MemoryLayout::run_on_function(shared_ptr<Function> function)
 
         for (descriptor::Tensor* tensor : node->liveness_new_list)
         {
+            if (greedy_by_size)
+            {
+                auto in_place = in_place_outputs.find(tensor);
+                if (in_place != in_place_outputs.end() && tensor_block.count(in_place->second))
+                {
+                    size_t index = tensor_block.at(in_place->second);
+                    blocks[index].m_tensors.push_back(tensor);
+                    tensor_block[tensor] = index;
+                }
+                else
+                {
+                    tensor_block[tensor] = blocks.size();
+                    blocks.push_back({MemoryManager::align(tensor->size(), m_alignment),
+                                      step,
+                                      ops.size() - 1,
+                                      0,
+                                      {tensor}});
+                }
+                continue;
+            }
             size_t offset = in_place_outputs.count(tensor)
                                 ? in_place_outputs.at(tensor)->get_pool_offset()
                                 : mm.allocate(tensor->size());
@@ -92,16 +204,44 @@ bool pass::MemoryLayout::run_on_function(shared_ptr<Function> function)
             {
                 if (reused_inputs.count(tensor) == 0)
                 {
-                    mm.free(tensor->get_pool_offset());
+                    if (greedy_by_size)
+                    {
+                        auto it = tensor_block.find(tensor);
+                        if (it != tensor_block.end())
+                        {
+                            blocks[it->second].m_end = step;
+                        }
+                    }
+                    else
+                    {
+                        mm.free(tensor->get_pool_offset());
+                    }
                 }
             }
         }
     }
-    function->set_temporary_pool_size(mm.max_allocated());
+
+    if (greedy_by_size)
+    {
+        function->set_temporary_pool_size(assign_greedy_by_size(blocks, ops.size()));
+        for (const LiveBlock& block : blocks)
+        {
+            for (descriptor::Tensor* tensor : block.m_tensors)
+            {
+                tensor->set_pool_offset(block.m_offset);
+            }
+        }
+    }
+    else
+    {
+        function->set_temporary_pool_size(mm.max_allocated());
+    }
 
     return false;
 }
 
+constexpr size_t pass::MemoryManager::s_null;
+
 pass::MemoryManager::node::node(size_t size, block_state state)
     : m_size{size}
     , m_state{state}
@@ -109,15 +249,24 @@ pass::MemoryManager::node::node(size_t size, block_state state)
 }
 
 pass::MemoryManager::MemoryManager(size_t alignment, bool disable_memory_reuse)
-    : m_alignment{alignment}
-    , m_scheme{disable_memory_reuse ? allocation_scheme::NO_REUSE : allocation_scheme::FIRST_FIT}
+    : MemoryManager(alignment,
+                    disable_memory_reuse ? allocation_scheme::NO_REUSE
+                                         : allocation_scheme::FIRST_FIT)
+{
+}
+
+pass::MemoryManager::MemoryManager(size_t alignment, allocation_scheme scheme)
+    : m_root{s_null}
+    , m_random_state{0x9e3779b97f4a7c15}
+    , m_alignment{alignment}
+    , m_scheme{scheme}
     , m_max_allocated{0}
 {
     if (m_alignment == 0)
     {
         throw invalid_argument("Memory alignment must be > 0");
     }
-    m_node_list.emplace_back(numeric_limits<size_t>::max(), block_state::FREE);
+    insert_block(0, node{numeric_limits<size_t>::max(), block_state::FREE});
 }
 
 size_t pass::MemoryManager::allocate(size_t size)
@@ -142,128 +291,245 @@ size_t pass::MemoryManager::no_reuse_allocator(size_t size)
 size_t pass::MemoryManager::best_fit(size_t size)
 {
     size = align(size, m_alignment);
-    size_t offset = 0;
-    size_t min_delta = numeric_limits<size_t>::max();
-    auto best_fit = m_node_list.end();
-    size_t best_offset = offset;
-    for (auto it = m_node_list.begin(); it != m_node_list.end(); ++it)
+    // Smallest free block that fits; the lowest offset among equal sizes
+    auto it = m_free_by_size.lower_bound({size, 0});
+    if (it == m_free_by_size.end())
     {
-        if (it->m_state == block_state::FREE && it->m_size >= size)
-        {
-            size_t delta = it->m_size - size;
-            if (delta < min_delta)
-            {
-                min_delta = delta;
-                best_fit = it;
-                best_offset = offset;
-            }
-        }
-        offset += it->m_size;
+        throw bad_alloc();
     }
+    return carve(it->second, size);
+}
 
-    if (best_fit == m_node_list.end())
+size_t pass::MemoryManager::first_fit(size_t size)
+{
+    size = align(size, m_alignment);
+    size_t t = find_first_fit(size);
+    if (t == s_null)
     {
         throw bad_alloc();
     }
+    return carve(m_tree[t].m_offset, size);
+}
+
+size_t pass::MemoryManager::carve(size_t offset, size_t size)
+{
+    node block = erase_block(offset);
+    insert_block(offset, node{size, block_state::ALLOCATED});
+    if (block.m_size > size)
+    {
+        insert_block(offset + size, node{block.m_size - size, block_state::FREE});
+    }
+    m_max_allocated = max(m_max_allocated, offset + size);
+    return offset;
+}
+
+void pass::MemoryManager::free(size_t offset)
+{
+    if (find_block(offset) == s_null)
+    {
+        throw runtime_error("bad free");
+    }
+    node block = erase_block(offset);
+    size_t start = offset;
+    size_t size = block.m_size;
+
+    size_t previous = find_previous_block(offset);
+    if (previous != s_null && m_tree[previous].m_block.is_free())
+    {
+        start = m_tree[previous].m_offset;
+        size += erase_block(start).m_size;
+    }
+    size_t next = find_block(offset + block.m_size);
+    if (next != s_null && m_tree[next].m_block.is_free())
+    {
+        // The free tail is unbounded and stays that way when joined
+        size_t next_size = erase_block(offset + block.m_size).m_size;
+        size = next_size == numeric_limits<size_t>::max() ? next_size : size + next_size;
+    }
+    insert_block(start, node{size, block_state::FREE});
+}
 
-    if (min_delta == 0)
+void pass::MemoryManager::dump(ostream& out)
+{
+    for (const node& n : get_node_list())
     {
-        // exact fit
-        best_fit->m_state = block_state::ALLOCATED;
+        out << "size=" << n.m_size << ", ";
+        out << (n.m_state == block_state::FREE ? "FREE" : "ALLOCATED");
+        out << "\n";
+    }
+}
+
+list<pass::MemoryManager::node> pass::MemoryManager::get_node_list() const
+{
+    list<node> blocks;
+    collect(m_root, blocks);
+    return blocks;
+}
+
+void pass::MemoryManager::insert_block(size_t offset, node block)
+{
+    size_t t;
+    if (m_unused_tree_nodes.empty())
+    {
+        t = m_tree.size();
+        m_tree.push_back({offset, block, 0, s_null, s_null, 0});
     }
     else
     {
-        m_node_list.insert(best_fit, node{size, block_state::ALLOCATED});
-        best_fit->m_size -= size;
+        t = m_unused_tree_nodes.back();
+        m_unused_tree_nodes.pop_back();
+        m_tree[t] = {offset, block, 0, s_null, s_null, 0};
     }
-    m_max_allocated = max(m_max_allocated, best_offset + size);
+    // xorshift; only needs to be cheap and deterministic
+    m_random_state ^= m_random_state << 13;
+    m_random_state ^= m_random_state >> 7;
+    m_random_state ^= m_random_state << 17;
+    m_tree[t].m_priority = m_random_state;
+    update(t);
 
-    return best_offset;
+    size_t left;
+    size_t right;
+    split(m_root, offset, left, right);
+    m_root = merge(merge(left, t), right);
+    if (block.is_free())
+    {
+        m_free_by_size.insert({block.m_size, offset});
+    }
 }
 
-size_t pass::MemoryManager::first_fit(size_t size)
+pass::MemoryManager::node pass::MemoryManager::erase_block(size_t offset)
 {
-    size = align(size, m_alignment);
-    size_t offset = 0;
-    bool found = false;
-    for (auto it = m_node_list.begin(); it != m_node_list.end(); ++it)
+    size_t left;
+    size_t middle;
+    size_t right;
+    split(m_root, offset, left, middle);
+    split(middle, offset + 1, middle, right);
+    node block = m_tree[middle].m_block;
+    m_unused_tree_nodes.push_back(middle);
+    m_root = merge(left, right);
+    if (block.is_free())
     {
-        if (it->m_state == block_state::FREE && it->m_size >= size)
+        m_free_by_size.erase({block.m_size, offset});
+    }
+    return block;
+}
+
+size_t pass::MemoryManager::find_block(size_t offset) const
+{
+    size_t t = m_root;
+    while (t != s_null && m_tree[t].m_offset != offset)
+    {
+        t = offset < m_tree[t].m_offset ? m_tree[t].m_left : m_tree[t].m_right;
+    }
+    return t;
+}
+
+size_t pass::MemoryManager::find_previous_block(size_t offset) const
+{
+    size_t rc = s_null;
+    size_t t = m_root;
+    while (t != s_null)
+    {
+        if (m_tree[t].m_offset < offset)
         {
-            if (it->m_size > size)
-            {
-                m_node_list.insert(it, node{size, block_state::ALLOCATED});
-                it->m_size -= size;
-            }
-            else
-            {
-                // exact fit
-                it->m_state = block_state::ALLOCATED;
-            }
+            rc = t;
+            t = m_tree[t].m_right;
+        }
+        else
+        {
+            t = m_tree[t].m_left;
+        }
+    }
+    return rc;
+}
 
-            found = true;
-            break;
+size_t pass::MemoryManager::find_first_fit(size_t size) const
+{
+    size_t t = m_root;
+    while (t != s_null && m_tree[t].m_max_free >= size)
+    {
+        size_t left = m_tree[t].m_left;
+        if (left != s_null && m_tree[left].m_max_free >= size)
+        {
+            t = left;
+        }
+        else if (m_tree[t].m_block.is_free() && m_tree[t].m_block.m_size >= size)
+        {
+            return t;
+        }
+        else
+        {
+            t = m_tree[t].m_right;
         }
-        offset += it->m_size;
     }
-    if (!found)
+    return s_null;
+}
+
+void pass::MemoryManager::update(size_t t)
+{
+    tree_node& n = m_tree[t];
+    n.m_max_free = n.m_block.is_free() ? n.m_block.m_size : 0;
+    if (n.m_left != s_null)
     {
-        throw bad_alloc();
+        n.m_max_free = max(n.m_max_free, m_tree[n.m_left].m_max_free);
     }
-    m_max_allocated = max(m_max_allocated, offset + size);
+    if (n.m_right != s_null)
+    {
+        n.m_max_free = max(n.m_max_free, m_tree[n.m_right].m_max_free);
+    }
+}
 
-    return offset;
+void pass::MemoryManager::split(size_t t, size_t offset, size_t& left, size_t& right)
+{
+    // left gets the blocks below offset, right the rest
+    if (t == s_null)
+    {
+        left = s_null;
+        right = s_null;
+    }
+    else if (m_tree[t].m_offset < offset)
+    {
+        split(m_tree[t].m_right, offset, m_tree[t].m_right, right);
+        left = t;
+        update(t);
+    }
+    else
+    {
+        split(m_tree[t].m_left, offset, left, m_tree[t].m_left);
+        right = t;
+        update(t);
+    }
 }
 
-void pass::MemoryManager::free(size_t offset)
+size_t pass::MemoryManager::merge(size_t left, size_t right)
 {
-    size_t search_offset = 0;
-    bool found = false;
-    for (auto it = m_node_list.begin(); it != m_node_list.end(); ++it)
+    // Every offset in left is below every offset in right
+    if (left == s_null)
     {
-        if (offset == search_offset)
-        {
-            list<node>::iterator it_next = next(it);
-            if (it == m_node_list.begin())
-            {
-                // free the first node in the list
-                it->m_state = block_state::FREE;
-            }
-            else
-            {
-                // node has predecessor
-                list<node>::iterator it_prev = prev(it);
-                if (it_prev->m_state == block_state::FREE)
-                {
-                    it->m_size += it_prev->m_size;
-                    m_node_list.erase(it_prev);
-                }
-            }
-            if (it_next != m_node_list.end() && it_next->m_state == block_state::FREE)
-            {
-                // join this node with next
-                it->m_size += it_next->m_size;
-                m_node_list.erase(it_next);
-            }
-            it->m_state = block_state::FREE;
-            found = true;
-            break;
-        }
-        search_offset += it->m_size;
+        return right;
     }
-    if (!found)
+    if (right == s_null)
     {
-        throw runtime_error("bad free");
+        return left;
+    }
+    if (m_tree[left].m_priority > m_tree[right].m_priority)
+    {
+        m_tree[left].m_right = merge(m_tree[left].m_right, right);
+        update(left);
+        return left;
     }
+    m_tree[right].m_left = merge(left, m_tree[right].m_left);
+    update(right);
+    return right;
 }
 
-void pass::MemoryManager::dump(ostream& out)
+void pass::MemoryManager::collect(size_t t, list<node>& blocks) const
 {
-    for (const node& n : m_node_list)
+    if (t != s_null)
     {
-        out << "size=" << n.m_size << ", ";
-        out << (n.m_state == block_state::FREE ? "FREE" : "ALLOCATED");
-        out << "\n";
+        collect(m_tree[t].m_left, blocks);
+        blocks.push_back(m_tree[t].m_block);
+        collect(m_tree[t].m_right, blocks);
     }
 }
 
@@ -18,7 +18,10 @@
 
 #include <limits>
 #include <list>
+#include <set>
 #include <sstream>
+#include <utility>
+#include <vector>
 
 #include "ngraph/pass/pass.hpp"
 
@@ -35,12 +38,20 @@ namespace ngraph
 class NGRAPH_API ngraph::pass::MemoryLayout : public FunctionPass
 {
 public:
-    MemoryLayout(size_t alignment = 1, bool disable_memory_sharing = false);
+    /// \param alignment Alignment of every tensor offset in the pool
+    /// \param disable_memory_sharing Give every tensor its own memory
+    /// \param greedy_by_size Assign offsets from the tensor lifetimes, largest tensor first,
+    ///        instead of allocating and freeing in execution order with first fit. This
+    ///        usually gives a smaller temporary pool. Ignored when memory sharing is disabled.
+    MemoryLayout(size_t alignment = 1,
+                 bool disable_memory_sharing = false,
+                 bool greedy_by_size = false);
     bool run_on_function(std::shared_ptr<ngraph::Function>) override;
 
 private:
     size_t m_alignment;
     bool m_disable_memory_sharing;
+    bool m_greedy_by_size;
 };
 
 class NGRAPH_API ngraph::pass::MemoryManager
@@ -70,7 +81,7 @@ public:
     };
 
     MemoryManager(size_t alignment = 1, bool disable_reuse = false);
-    // memory_manager& alignment(size_t a);
+    MemoryManager(size_t alignment, allocation_scheme scheme);
 
     size_t allocate(size_t size);
     void free(size_t offset);
@@ -79,19 +90,46 @@ public:
 
     static size_t align(size_t x, size_t alignment);
 
-    std::list<node>::iterator begin() { return m_node_list.begin(); }
-    std::list<node>::iterator end() { return m_node_list.end(); }
-    std::list<node>::const_iterator begin() const { return m_node_list.cbegin(); }
-    std::list<node>::const_iterator end() const { return m_node_list.cend(); }
-    const std::list<node>& get_node_list() const { return m_node_list; }
+    /// \brief The blocks in offset order. The last block is the unbounded free tail.
+    std::list<node> get_node_list() const;
     size_t max_allocated() const { return m_max_allocated; }
 
 private:
+    // Blocks are kept in a treap ordered by offset, stored in m_tree and linked by index.
+    // Every tree node also holds the size of the largest free block in its subtree, which
+    // lets first fit descend directly to the lowest fitting offset. Free blocks are also
+    // indexed by (size, offset) for best fit. Allocate and free are O(log n).
+    struct tree_node
+    {
+        size_t m_offset;
+        node m_block;
+        size_t m_priority;
+        size_t m_left;
+        size_t m_right;
+        size_t m_max_free;
+    };
+    static constexpr size_t s_null = std::numeric_limits<size_t>::max();
+
     size_t first_fit(size_t size);
     size_t best_fit(size_t size);
     size_t no_reuse_allocator(size_t size);
-
-    std::list<node> m_node_list;
+    size_t carve(size_t offset, size_t size);
+
+    void insert_block(size_t offset, node block);
+    node erase_block(size_t offset);
+    size_t find_block(size_t offset) const;
+    size_t find_previous_block(size_t offset) const;
+    size_t find_first_fit(size_t size) const;
+    void update(size_t t);
+    void split(size_t t, size_t offset, size_t& left, size_t& right);
+    size_t merge(size_t left, size_t right);
+    void collect(size_t t, std::list<node>& blocks) const;
+
+    std::vector<tree_node> m_tree;
+    std::vector<size_t> m_unused_tree_nodes;
+    size_t m_root;
+    std::set<std::pair<size_t, size_t>> m_free_by_size;
+    size_t m_random_state;
     size_t m_alignment;
     allocation_scheme m_scheme;
     size_t m_max_allocated;
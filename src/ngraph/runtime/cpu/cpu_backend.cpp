@@ -14,13 +14,22 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <thread>
+
 #if defined(NGRAPH_TBB_ENABLE)
 #include <tbb/tbb_stddef.h>
 #endif
 
 #include "cpu_backend_visibility.h"
 
+#include "ngraph/cpio.hpp"
 #include "ngraph/env_util.hpp"
+#include "ngraph/factory.hpp"
+#include "ngraph/file_util.hpp"
 #include "ngraph/graph_util.hpp"
 #include "ngraph/log.hpp"
 #include "ngraph/runtime/backend_manager.hpp"
@@ -29,7 +38,26 @@
 #include "ngraph/runtime/cpu/cpu_call_frame.hpp"
 #include "ngraph/runtime/cpu/cpu_external_function.hpp"
 #include "ngraph/runtime/cpu/cpu_tensor.hpp"
+#include "ngraph/runtime/cpu/dnnl_utils.hpp"
+#include "ngraph/runtime/cpu/op/batch_norm_relu.hpp"
+#include "ngraph/runtime/cpu/op/bounded_relu.hpp"
+#include "ngraph/runtime/cpu/op/conv_add.hpp"
+#include "ngraph/runtime/cpu/op/conv_relu.hpp"
+#include "ngraph/runtime/cpu/op/convert_layout.hpp"
+#include "ngraph/runtime/cpu/op/deconv.hpp"
+#include "ngraph/runtime/cpu/op/dropout.hpp"
+#include "ngraph/runtime/cpu/op/gelu_backprop.hpp"
+#include "ngraph/runtime/cpu/op/group_conv_bias.hpp"
+#include "ngraph/runtime/cpu/op/leaky_relu.hpp"
+#include "ngraph/runtime/cpu/op/lstm.hpp"
+#include "ngraph/runtime/cpu/op/matmul_bias.hpp"
+#include "ngraph/runtime/cpu/op/max_pool_with_indices.hpp"
+#include "ngraph/runtime/cpu/op/quantized_matmul.hpp"
+#include "ngraph/runtime/cpu/op/rnn.hpp"
+#include "ngraph/runtime/cpu/op/sigmoid_mul.hpp"
+#include "ngraph/runtime/cpu/op/update_slice.hpp"
 #include "ngraph/runtime/cpu/static_initialize.hpp"
+#include "ngraph/serializer.hpp"
 #include "ngraph/util.hpp"
 
 #ifdef NGRAPH_CPU_MLIR_ENABLE
@@ -40,6 +68,36 @@
 using namespace ngraph;
 using namespace std;
 
+namespace
+{
+    // CPU-only ops are created by the CPU passes; saved executables need factories for them
+    // to deserialize
+    void register_cpu_op_factories()
+    {
+        auto& registry = FactoryRegistry<Node>::get();
+        registry.register_factory<op::BatchNormTrainingRelu>();
+        registry.register_factory<op::BatchNormInferenceRelu>();
+        registry.register_factory<op::BoundedRelu>();
+        registry.register_factory<op::ConvolutionAdd>();
+        registry.register_factory<op::ConvolutionRelu>();
+        registry.register_factory<runtime::cpu::op::ConvertLayout>();
+        registry.register_factory<op::DeconvolutionBias>();
+        registry.register_factory<op::Dropout>();
+        registry.register_factory<op::GeluBackprop>();
+        registry.register_factory<op::GroupConvolutionBias>();
+        registry.register_factory<op::CPULeakyRelu>();
+        registry.register_factory<op::Lstm>();
+        registry.register_factory<op::MatmulBias>();
+        registry.register_factory<op::MaxPoolWithIndices>();
+        registry.register_factory<op::MaxPoolWithIndicesBackprop>();
+        registry.register_factory<op::QuantizedMatmul>();
+        registry.register_factory<op::Rnn>();
+        registry.register_factory<op::SigmoidMultiply>();
+        registry.register_factory<op::SigmoidMultiplyBackprop>();
+        registry.register_factory<op::UpdateSlice>();
+    }
+}
+
 extern "C" CPU_BACKEND_API void ngraph_register_cpu_backend()
 {
     runtime::BackendManager::register_backend("CPU", [](const std::string& config) {
@@ -51,6 +109,7 @@ extern "C" CPU_BACKEND_API void ngraph_register_cpu_backend()
             tbb::TBB_runtime_interface_version();
 #endif
             ngraph::runtime::cpu::register_builders();
+            register_cpu_op_factories();
             is_initialized = true;
         }
         return make_shared<runtime::cpu::CPU_Backend>(config);
@@ -77,6 +136,7 @@ runtime::cpu::CPU_Backend::CPU_Backend(const string& config)
 runtime::cpu::CPU_Backend::~CPU_Backend()
 {
     m_exec_map.clear();
+    m_structural_exec_map.clear();
 }
 
 shared_ptr<runtime::cpu::CPU_CallFrame> runtime::cpu::CPU_Backend::make_call_frame(
@@ -139,18 +199,210 @@ shared_ptr<runtime::Executable>
             return rc;
         }
     }
-    rc = make_shared<CPU_Executable>(func,
-                                     pass_config,
-                                     get_host_memory_allocator(),
-                                     performance_counters_enabled,
-                                     m_execution_mode);
+
+    // The key has to be computed before compiling since compilation rewrites func in place
+    string compile_key = get_compile_key(*func, pass_config, performance_counters_enabled);
+    if (!compile_key.empty())
+    {
+        {
+            std::lock_guard<std::mutex> guard(m_exec_map_mutex);
+            auto it = m_structural_exec_map.find(compile_key);
+            if (it != m_structural_exec_map.end())
+            {
+                NGRAPH_DEBUG << "Reusing executable for structurally identical function "
+                             << func->get_name();
+                rc = it->second;
+                m_exec_map.insert({func, rc});
+                return rc;
+            }
+        }
+        rc = load_cached(compile_key);
+    }
+    if (!rc)
+    {
+        rc = make_shared<CPU_Executable>(func,
+                                         pass_config,
+                                         get_host_memory_allocator(),
+                                         performance_counters_enabled,
+                                         m_execution_mode);
+        if (!compile_key.empty())
+        {
+            save_cached(compile_key, *rc);
+        }
+    }
     {
         std::lock_guard<std::mutex> guard(m_exec_map_mutex);
         m_exec_map.insert({func, rc});
+        if (!compile_key.empty())
+        {
+            m_structural_exec_map.insert({compile_key, rc});
+        }
         return rc;
     }
 }
 
+string runtime::cpu::CPU_Backend::get_cache_path(const string& key) const
+{
+    string cache_dir = getenv_string("NGRAPH_CPU_CACHE_DIR");
+    if (cache_dir.empty() || m_execution_mode != EXECUTION_MODE::DIRECT_EXECUTION)
+    {
+        return "";
+    }
+    // The key starts with the structural hash; the rest is folded into the name so that
+    // different pass configurations of one function get files of their own
+    stringstream name;
+    name << key.substr(0, key.find(';')) << "-" << hex << hash<string>()(key) << ".ngcpu";
+    return file_util::path_join(cache_dir, name.str());
+}
+
+shared_ptr<runtime::Executable> runtime::cpu::CPU_Backend::load_cached(const string& key)
+{
+    shared_ptr<Executable> exec;
+    string path = get_cache_path(key);
+    if (path.empty())
+    {
+        return exec;
+    }
+    ifstream in(path, ios_base::binary);
+    string saved_key;
+    // The file names only hold part of the key, the full key on the first line decides
+    if (!in || !getline(in, saved_key) || saved_key != key)
+    {
+        return exec;
+    }
+    try
+    {
+        exec = load(in);
+    }
+    catch (const exception& e)
+    {
+        NGRAPH_WARN << "Ignoring unreadable CPU cache file " << path << ": " << e.what();
+        exec = nullptr;
+    }
+    if (exec)
+    {
+        NGRAPH_DEBUG << "Loaded executable from CPU cache file " << path;
+    }
+    return exec;
+}
+
+void runtime::cpu::CPU_Backend::save_cached(const string& key, Executable& exec)
+{
+    string path = get_cache_path(key);
+    if (path.empty())
+    {
+        return;
+    }
+    // Written to a file of its own and renamed into place, so that threads and processes
+    // sharing the directory never read a partly written executable
+    stringstream tmp_name;
+    tmp_name << path << "." << hex << hash<thread::id>()(this_thread::get_id()) << "-"
+             << chrono::steady_clock::now().time_since_epoch().count() << ".tmp";
+    string tmp_path = tmp_name.str();
+    try
+    {
+        file_util::make_directory(file_util::get_directory(path));
+        {
+            ofstream out(tmp_path, ios_base::binary);
+            if (!out)
+            {
+                throw ngraph_error("Unable to create " + tmp_path);
+            }
+            out << key << "\n";
+            exec.save(out);
+        }
+        if (rename(tmp_path.c_str(), path.c_str()) != 0)
+        {
+            throw ngraph_error("Unable to rename " + tmp_path + " to " + path);
+        }
+    }
+    catch (const exception& e)
+    {
+        // Executables with ops the serializer cannot rebuild are only cached in memory
+        NGRAPH_DEBUG << "Not writing CPU cache file " << path << ": " << e.what();
+        file_util::remove_file(tmp_path);
+    }
+}
+
+string runtime::cpu::CPU_Backend::get_compile_key(const Function& func,
+                                                  const ngraph::pass::PassConfig& pass_config,
+                                                  bool performance_counters_enabled) const
+{
+    if (getenv_bool("NGRAPH_CPU_DISABLE_STRUCTURAL_CACHE"))
+    {
+        return "";
+    }
+    string hash = structural_hash(func);
+    if (hash.empty())
+    {
+        return hash;
+    }
+    stringstream key;
+    key << hash << ";" << static_cast<int>(m_execution_mode) << ";"
+        << performance_counters_enabled << ";" << dnnl_utils::get_build_signature();
+    for (auto& enable : pass_config.get_enables())
+    {
+        key << ";" << enable.first << "=" << enable.second;
+    }
+    for (auto& attribute : pass_config.get_pass_attributes())
+    {
+        key << ";" << attribute.first << "=" << attribute.second;
+    }
+    return key.str();
+}
+
+shared_ptr<runtime::Executable> runtime::cpu::CPU_Backend::load(istream& in)
+{
+    shared_ptr<Executable> exec;
+    cpio::Reader reader(in);
+    map<string, string> entries;
+    for (const cpio::FileInfo& info : reader.get_file_info())
+    {
+        vector<char> buffer = reader.read(info);
+        entries[info.get_name()] = string(buffer.data(), buffer.size());
+    }
+    // Files written by another build, or on a machine where DNNL picks other kernels, are
+    // not loaded
+    if (entries["save_info"] != CPU_Executable::get_save_info())
+    {
+        return exec;
+    }
+
+    ngraph::pass::PassConfig pass_config;
+    bool performance_counters_enabled = false;
+    stringstream config(entries["pass_config"]);
+    string kind;
+    while (config >> kind)
+    {
+        string name;
+        bool value;
+        if (kind == "performance_counters")
+        {
+            config >> performance_counters_enabled;
+        }
+        else if (kind == "enable" && config >> name >> value)
+        {
+            pass_config.set_pass_enable(name, value);
+        }
+        else if (kind == "attribute" && config >> name >> value)
+        {
+            pass_config.set_pass_attribute(name, value);
+        }
+        else
+        {
+            throw ngraph_error("CPU backend: malformed pass configuration in saved executable");
+        }
+    }
+
+    shared_ptr<Function> func = deserialize(entries["model"]);
+    exec = make_shared<CPU_Executable>(func,
+                                       entries["pass_state"],
+                                       pass_config,
+                                       get_host_memory_allocator(),
+                                       performance_counters_enabled);
+    return exec;
+}
+
 bool runtime::cpu::CPU_Backend::is_supported(const Node& /* op */) const
 {
     return true;
@@ -19,6 +19,8 @@
 #include <map>
 #include <memory>
 #include <mutex>
+#include <string>
+#include <unordered_map>
 
 #include "cpu_backend_visibility.h"
 #include "ngraph/pass/pass_config.hpp"
@@ -70,6 +72,10 @@ namespace ngraph
 
                 void remove_compiled_function(std::shared_ptr<Executable> exec) override;
 
+                /// \brief Loads an executable written by CPU_Executable::save. The CPU passes
+                ///        are not rerun; the saved layouts and memory assignment are used as is.
+                std::shared_ptr<Executable> load(std::istream& input_stream) override;
+
                 Allocator* get_host_memory_allocator() override;
                 void set_host_memory_allocator(Allocator* allocator) override;
 
@@ -77,11 +83,33 @@ namespace ngraph
                 bool is_supported_property(const Property prop) const override;
 
             private:
+                /// \brief Key for m_structural_exec_map: the structural hash of the function
+                ///        combined with everything else that changes the compiled result,
+                ///        including dnnl_utils::get_build_signature(). Returns an empty string
+                ///        if the function cannot be hashed.
+                std::string get_compile_key(const Function& func,
+                                            const ngraph::pass::PassConfig& pass_config,
+                                            bool performance_counters_enabled) const;
+                /// \brief File in NGRAPH_CPU_CACHE_DIR holding the executable for key, or an
+                ///        empty string if executables are not cached on disk
+                std::string get_cache_path(const std::string& key) const;
+                /// \brief Loads the executable for key from NGRAPH_CPU_CACHE_DIR. Returns
+                ///        nullptr if there is no file for key, the file is unreadable, or
+                ///        load() rejects it because another build signature wrote it.
+                std::shared_ptr<Executable> load_cached(const std::string& key);
+                /// \brief Saves exec for key to NGRAPH_CPU_CACHE_DIR, unless it cannot be saved
+                void save_cached(const std::string& key, Executable& exec);
+
                 // this mutex will be used to protect the addition and deletion
                 // of function to m_exec_map across multiple threads
                 std::mutex m_exec_map_mutex;
                 std::unordered_map<std::shared_ptr<Function>, std::shared_ptr<Executable>>
                     m_exec_map;
+                // Executables for structurally identical functions are shared, so rebuilding
+                // a graph (e.g. on every session start) does not recompile it. With
+                // NGRAPH_CPU_CACHE_DIR set they are also saved there for later processes.
+                std::unordered_map<std::string, std::shared_ptr<Executable>>
+                    m_structural_exec_map;
                 Allocator* m_allocator;
                 EXECUTION_MODE m_execution_mode;
             };
@@ -15,6 +15,7 @@
 //*****************************************************************************
 
 #include <algorithm>
+#include <limits>
 #include <thread>
 
 #include "ngraph/env_util.hpp"
@@ -24,6 +25,7 @@
 #include "ngraph/runtime/cpu/cpu_tensor.hpp"
 #include "ngraph/runtime/cpu/cpu_tracing.hpp"
 #include "ngraph/runtime/cpu/dnnl_emitter.hpp"
+#include "ngraph/runtime/cpu/dnnl_utils.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -49,6 +51,10 @@ runtime::cpu::CPU_CallFrame::CPU_CallFrame(std::shared_ptr<CPU_ExternalFunction>
             std::to_string(std::thread::hardware_concurrency()) + "]");
     }
 
+    m_shared_memory = m_external_function->is_direct_execution() &&
+                      getenv_bool("NGRAPH_CPU_SHARED_CONTEXT_MEMORY");
+    m_allocator = allocator;
+
     setup_runtime_context(allocator);
     if (!m_external_function->is_direct_execution())
     {
@@ -60,6 +66,13 @@ runtime::cpu::CPU_CallFrame::CPU_CallFrame(std::shared_ptr<CPU_ExternalFunction>
 
 runtime::cpu::CPU_CallFrame::~CPU_CallFrame()
 {
+    // The timeline shows the last call, written once rather than after every call
+    if (runtime::cpu::IsTracingEnabled() && m_timeline_ctx.load() < m_ctx_vec.size())
+    {
+        GenerateTimeline(m_external_function->get_op_attrs(),
+                         m_ctx_vec[m_timeline_ctx.load()]->op_durations,
+                         m_external_function->get_function_name() + ".timeline.json");
+    }
     cleanup_runtime_context();
     if (!m_external_function->is_direct_execution())
     {
@@ -76,11 +89,18 @@ void runtime::cpu::CPU_CallFrame::inner_call(
     vector<void*> inputs;
     vector<void*> outputs;
 
+    // A tensor that is not stale only lets this context reuse its intermediates if the context
+    // saw the same tensor in the same place last time and no other context read it since
+    auto& last_inputs = m_ctx_last_inputs[id];
+    last_inputs.resize(input_tvs.size(), nullptr);
     for (size_t i = 0; i < input_tvs.size(); i++)
     {
         shared_ptr<runtime::cpu::CPUTensor> tv =
             static_pointer_cast<runtime::cpu::CPUTensor>(input_tvs[i]);
-        if (disable_caching)
+        bool reused = tv->exchange_last_reader(m_ctx_vec[id]) == m_ctx_vec[id] &&
+                      last_inputs[i] == tv.get();
+        last_inputs[i] = tv.get();
+        if (disable_caching || !reused)
         {
             m_ctx_vec[id]->p_en[i] = true;
         }
@@ -110,9 +130,74 @@ void runtime::cpu::CPU_CallFrame::inner_call(
 
     if (runtime::cpu::IsTracingEnabled())
     {
-        GenerateTimeline(m_external_function->get_op_attrs(),
-                         m_ctx_vec[id]->op_durations,
-                         m_external_function->get_function_name() + ".timeline.json");
+        m_timeline_ctx.store(id);
+    }
+}
+
+bool runtime::cpu::CPU_CallFrame::try_acquire_context(size_t id)
+{
+    bool busy = false;
+    return !m_ctx_busy[id].load() && m_ctx_busy[id].compare_exchange_strong(busy, true);
+}
+
+size_t runtime::cpu::CPU_CallFrame::acquire_context()
+{
+    // Remember the context each thread ran last so that a thread calling repeatedly keeps
+    // landing on the same context, whose cached intermediates still match its inputs
+    static thread_local const CPU_CallFrame* t_call_frame = nullptr;
+    static thread_local size_t t_ctx = 0;
+    size_t hint = 0;
+    if (t_call_frame == this)
+    {
+        hint = t_ctx;
+    }
+    else
+    {
+        hint = std::hash<std::thread::id>()(std::this_thread::get_id()) % m_num_ctx;
+    }
+
+    size_t id = m_num_ctx;
+    for (size_t i = 0; i < m_num_ctx && id == m_num_ctx; i++)
+    {
+        if (try_acquire_context((hint + i) % m_num_ctx))
+        {
+            id = (hint + i) % m_num_ctx;
+        }
+    }
+    if (id == m_num_ctx)
+    {
+        // All contexts are busy. Register as a waiter before scanning again so that a
+        // release either sees the waiter or this scan sees the released context.
+        std::unique_lock<std::mutex> lck(m_mutex);
+        m_num_waiters++;
+        m_cv.wait(lck, [&]() {
+            for (size_t i = 0; i < m_num_ctx; i++)
+            {
+                if (try_acquire_context((hint + i) % m_num_ctx))
+                {
+                    id = (hint + i) % m_num_ctx;
+                    return true;
+                }
+            }
+            return false;
+        });
+        m_num_waiters--;
+    }
+
+    t_call_frame = this;
+    t_ctx = id;
+    return id;
+}
+
+void runtime::cpu::CPU_CallFrame::release_context(size_t id)
+{
+    m_ctx_busy[id].store(false);
+    if (m_num_waiters.load() > 0)
+    {
+        {
+            std::lock_guard<std::mutex> lck(m_mutex);
+        }
+        m_cv.notify_one();
     }
 }
 
@@ -120,44 +205,167 @@ void runtime::cpu::CPU_CallFrame::call(
     const std::vector<std::shared_ptr<runtime::Tensor>>& output_tvs,
     const std::vector<std::shared_ptr<runtime::Tensor>>& input_tvs)
 {
-    size_t id = 0;
-    auto disable_caching = false;
+    size_t id = acquire_context();
+
+    if (m_shared_memory)
     {
-        std::unique_lock<std::mutex> lck(m_mutex);
-        while (m_num_ctx_available == 0)
+        acquire_buffer_set(id);
+    }
+
+    m_ctx_vec[id]->pc = 0;
+    propagate_layouts(output_tvs, m_external_function->get_result_layout_descriptors());
+    inner_call(output_tvs, input_tvs, id, false);
+
+    if (m_shared_memory)
+    {
+        release_buffer_set(id);
+    }
+    release_context(id);
+}
+
+void runtime::cpu::CPU_CallFrame::acquire_buffer_set(size_t id)
+{
+    std::lock_guard<std::mutex> lock(m_buffer_set_mutex);
+    BufferSet* buffer_set = nullptr;
+    size_t set_index = m_ctx_buffer_set[id];
+    if (set_index < m_buffer_sets.size() && !m_buffer_sets[set_index]->in_use)
+    {
+        buffer_set = m_buffer_sets[set_index].get();
+    }
+    for (size_t i = 0; buffer_set == nullptr && i < m_buffer_sets.size(); i++)
+    {
+        if (!m_buffer_sets[i]->in_use)
         {
-            m_cv.wait(lck);
+            set_index = i;
+            buffer_set = m_buffer_sets[i].get();
         }
-
-        for (size_t i = 0; i < m_num_ctx; i++)
+    }
+    if (buffer_set == nullptr)
+    {
+        // More calls are in flight than ever before, grow the pool by one set
+        set_index = m_buffer_sets.size();
+        m_buffer_sets.emplace_back(new BufferSet);
+        buffer_set = m_buffer_sets.back().get();
+        size_t alignment = runtime::cpu::CPU_ExternalFunction::s_memory_pool_alignment;
+        for (auto buffer_size : m_external_function->get_memory_buffer_sizes())
         {
-            if (m_id_pool[i])
-            {
-                id = i;
-                break;
-            }
+            buffer_set->memory_buffers.push_back(
+                new AlignedBuffer(buffer_size, alignment, m_allocator));
         }
-        NGRAPH_CHECK(id != m_num_ctx);
-        m_id_pool[id] = false;
-        if (id != m_prev_ctx)
+        auto scratchpad_size = m_external_function->get_dnnl_emitter()->get_max_scratchpad_size();
+        if (scratchpad_size > 0)
         {
-            // Disable caching since staleness hints are no longer
-            // applicable to this context
-            disable_caching = true;
+            buffer_set->scratchpad_buffer =
+                new AlignedBuffer(scratchpad_size, alignment, m_allocator);
         }
-        m_prev_ctx = id;
-        m_num_ctx_available--;
+        buffer_set->owner_ctx = id;
     }
 
-    m_ctx_vec[id]->pc = 0;
-    propagate_layouts(output_tvs, m_external_function->get_result_layout_descriptors());
-    inner_call(output_tvs, input_tvs, id, disable_caching);
+    auto ctx = m_ctx_vec[id];
+    if (buffer_set->owner_ctx != id)
+    {
+        // The intermediates in this set belong to another context, nothing can be reused
+        ctx->buffers_rebound = true;
+        buffer_set->owner_ctx = id;
+    }
+    if (set_index != m_ctx_buffer_set[id])
+    {
+        ctx->buffers_rebound = true;
+        ctx->memory_buffers = buffer_set->memory_buffers;
+        ctx->scratchpad_buffer = buffer_set->scratchpad_buffer;
+        m_ctx_buffer_set[id] = set_index;
+    }
+    buffer_set->in_use = true;
+}
+
+void runtime::cpu::CPU_CallFrame::release_buffer_set(size_t id)
+{
+    std::lock_guard<std::mutex> lock(m_buffer_set_mutex);
+    m_buffer_sets[m_ctx_buffer_set[id]]->in_use = false;
+}
 
-    m_mutex.lock();
-    m_id_pool[id] = true;
-    m_num_ctx_available++;
-    m_mutex.unlock();
-    m_cv.notify_one();
+size_t runtime::cpu::CPU_CallFrame::get_dnnl_context_bytes(size_t id) const
+{
+    auto ctx = m_ctx_vec[id];
+    const auto& dnnl_emitter = m_external_function->get_dnnl_emitter();
+    size_t bytes = 0;
+    for (auto p : ctx->dnnl_primitives)
+    {
+        if (p)
+        {
+            bytes += dnnl_utils::get_memory_consumption(*p);
+        }
+    }
+    // The memory objects only wrap tensor memory, each holds its descriptor
+    for (auto m : ctx->dnnl_memories)
+    {
+        if (m)
+        {
+            bytes += sizeof(dnnl::memory::desc);
+        }
+    }
+    for (auto s : ctx->dnnl_scratchpad_mds)
+    {
+        if (s)
+        {
+            bytes += sizeof(dnnl::memory::desc);
+        }
+    }
+    for (auto w : ctx->dnnl_workspaces)
+    {
+        bytes += dnnl_emitter->get_workspace_size(w);
+    }
+    return bytes;
+}
+
+runtime::cpu::CPUMemoryUsage runtime::cpu::CPU_CallFrame::get_memory_usage()
+{
+    // Contexts build their DNNL objects on their first call, so every context is held while
+    // counting. A call in flight holds a single context and releases it without waiting.
+    for (size_t i = 0; i < m_num_ctx; i++)
+    {
+        while (!try_acquire_context(i))
+        {
+            std::this_thread::yield();
+        }
+    }
+    std::unique_lock<std::mutex> lock(m_buffer_set_mutex);
+    CPUMemoryUsage usage;
+    usage.shared_bytes = m_external_function->get_constant_pool_size();
+    for (auto& buffer_set : m_buffer_sets)
+    {
+        for (auto buffer : buffer_set->memory_buffers)
+        {
+            usage.shared_bytes += buffer->size();
+        }
+        if (buffer_set->scratchpad_buffer)
+        {
+            usage.shared_bytes += buffer_set->scratchpad_buffer->size();
+        }
+    }
+    for (size_t i = 0; i < m_num_ctx; i++)
+    {
+        auto ctx = m_ctx_vec[i];
+        size_t context_bytes = get_dnnl_context_bytes(i);
+        if (!m_shared_memory)
+        {
+            for (auto buffer : ctx->memory_buffers)
+            {
+                context_bytes += buffer->size();
+            }
+            if (m_external_function->is_direct_execution() && ctx->scratchpad_buffer)
+            {
+                context_bytes += ctx->scratchpad_buffer->size();
+            }
+        }
+        usage.context_bytes.push_back(context_bytes);
+    }
+    lock.unlock();
+    for (size_t i = 0; i < m_num_ctx; i++)
+    {
+        release_context(i);
+    }
+    return usage;
 }
 
 void runtime::cpu::CPU_CallFrame::propagate_layouts(
@@ -182,13 +390,18 @@ void runtime::cpu::CPU_CallFrame::propagate_layouts(
 
 void runtime::cpu::CPU_CallFrame::setup_runtime_context(Allocator* allocator)
 {
+    m_ctx_busy.reset(new std::atomic<bool>[m_num_ctx]);
+    m_ctx_last_inputs.assign(m_num_ctx, std::vector<const runtime::Tensor*>());
     for (size_t i = 0; i < m_num_ctx; i++)
     {
-        m_id_pool[i] = true;
+        m_ctx_busy[i].store(false);
         auto ctx = new CPURuntimeContext;
         m_ctx_vec.push_back(ctx);
 
         ctx->pc = 0;
+        ctx->op_counters = m_external_function->is_direct_execution()
+                               ? m_external_function->get_op_counters().add_shard()
+                               : nullptr;
         ctx->op_durations = nullptr;
         if (runtime::cpu::IsTracingEnabled())
         {
@@ -197,15 +410,19 @@ void runtime::cpu::CPU_CallFrame::setup_runtime_context(Allocator* allocator)
         ctx->p_en = new bool[m_external_function->get_parameter_layout_descriptors().size()];
 
         ctx->first_iteration = true;
+        ctx->buffers_rebound = false;
 
         ctx->buffer_data = std::vector<void*>(m_external_function->get_buffer_size());
 
-        // Create temporary buffer pools
+        // Create temporary buffer pools, unless they come from the shared buffer sets
         size_t alignment = runtime::cpu::CPU_ExternalFunction::s_memory_pool_alignment;
-        for (auto buffer_size : m_external_function->get_memory_buffer_sizes())
+        if (!m_shared_memory)
         {
-            auto buffer = new AlignedBuffer(buffer_size, alignment, allocator);
-            ctx->memory_buffers.push_back(buffer);
+            for (auto buffer_size : m_external_function->get_memory_buffer_sizes())
+            {
+                auto buffer = new AlignedBuffer(buffer_size, alignment, allocator);
+                ctx->memory_buffers.push_back(buffer);
+            }
         }
         const auto& dnnl_emitter = m_external_function->get_dnnl_emitter();
         // Create scratchpad
@@ -218,7 +435,7 @@ void runtime::cpu::CPU_CallFrame::setup_runtime_context(Allocator* allocator)
                 std::vector<dnnl::memory*>(dnnl_emitter->get_dnnl_memories().size());
             ctx->dnnl_scratchpad_mds =
                 std::vector<dnnl::memory::desc*>(dnnl_emitter->get_dnnl_scratchpad_mds().size());
-            if (scratchpad_size > 0)
+            if (scratchpad_size > 0 && !m_shared_memory)
             {
                 ctx->scratchpad_buffer = new AlignedBuffer(scratchpad_size, alignment, allocator);
             }
@@ -239,7 +456,7 @@ void runtime::cpu::CPU_CallFrame::setup_runtime_context(Allocator* allocator)
         {
             // For codegen mode, graph and global control are now part of the code generated
             // CPURuntimeContextCG class.
-            ctx->G = new tbb::flow::graph;
+            ctx->op_pending = new std::atomic<size_t>[m_external_function->get_functors().size()];
             const auto envParallelism = getenv_int("NGRAPH_INTER_OP_PARALLELISM");
             const auto parallelism = envParallelism <= 0 ? 1 : envParallelism;
             ctx->c =
@@ -247,7 +464,7 @@ void runtime::cpu::CPU_CallFrame::setup_runtime_context(Allocator* allocator)
         }
 #endif
     }
-    m_num_ctx_available = m_num_ctx;
+    m_ctx_buffer_set.assign(m_num_ctx, std::numeric_limits<size_t>::max());
 }
 
 void runtime::cpu::CPU_CallFrame::cleanup_runtime_context()
@@ -267,15 +484,18 @@ void runtime::cpu::CPU_CallFrame::cleanup_runtime_context()
         {
             delete m;
         }
-        for (auto buffer : ctx->memory_buffers)
+        if (!m_shared_memory)
         {
-            delete buffer;
+            for (auto buffer : ctx->memory_buffers)
+            {
+                delete buffer;
+            }
         }
         for (auto s : ctx->dnnl_scratchpad_mds)
         {
             delete s;
         }
-        if (m_external_function->is_direct_execution())
+        if (m_external_function->is_direct_execution() && !m_shared_memory)
         {
             delete ctx->scratchpad_buffer;
         }
@@ -285,23 +505,19 @@ void runtime::cpu::CPU_CallFrame::cleanup_runtime_context()
         {
             // For codegen mode, graph and global control are now part of a code generated
             // CPURuntimeContext class.
-
-            // delete graph G and nodes in G
-            ctx->G->wait_for_all();
-            std::vector<tbb::flow::graph_node*> to_be_deleted;
-            for (auto it = ctx->G->begin(); it != ctx->G->end(); it++)
-            {
-                to_be_deleted.push_back(&(*it));
-            }
-            delete ctx->G;
-            for (auto node : to_be_deleted)
-            {
-                delete node;
-            }
+            delete[] ctx->op_pending;
             delete ctx->c;
         }
 #endif
         delete ctx;
     }
-    m_num_ctx_available = 0;
+    for (auto& buffer_set : m_buffer_sets)
+    {
+        for (auto buffer : buffer_set->memory_buffers)
+        {
+            delete buffer;
+        }
+        delete buffer_set->scratchpad_buffer;
+    }
+    m_buffer_sets.clear();
 }
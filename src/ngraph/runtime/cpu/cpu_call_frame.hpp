@@ -16,8 +16,10 @@
 
 #pragma once
 
+#include <atomic>
 #include <condition_variable>
 #include <functional>
+#include <limits>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -51,6 +53,19 @@ namespace ngraph
             using DestroyContextFuncCG = std::function<DestroyContextFuncTy>;
             using EntryPoint = std::function<EntryPointTy>;
 
+            /// \brief Resident memory of a call frame in bytes. shared_bytes is held once for
+            ///        all contexts, context_bytes[i] only by context i.
+            ///
+            /// The DNNL primitives, memory objects, scratchpad descriptors and workspaces a
+            /// context builds on its first call are counted in its context_bytes. A primitive
+            /// counts what DNNL reports for the memory_consumption query. Whatever DNNL
+            /// allocates inside its kernels while they run is not counted.
+            struct CPUMemoryUsage
+            {
+                size_t shared_bytes = 0;
+                std::vector<size_t> context_bytes;
+            };
+
             // Compile and execute graphs
             class CPU_CallFrame
             {
@@ -77,6 +92,11 @@ namespace ngraph
                 void setup_cg_runtime_context();
                 void cleanup_runtime_context();
 
+                /// \brief Report the memory held by constants, intermediate pools and dnnl
+                ///        objects, split into shared and per-context parts. Waits for the calls
+                ///        in flight and holds off new ones while it counts.
+                CPUMemoryUsage get_memory_usage();
+
             protected:
                 CPU_CallFrame(const CPU_CallFrame&) = delete;
                 CPU_CallFrame(CPU_CallFrame&&) = delete;
@@ -87,15 +107,54 @@ namespace ngraph
                                 const size_t id,
                                 const bool disable_caching = true);
 
+                // A set of temporary pools plus a dnnl scratchpad, enough for one call
+                struct BufferSet
+                {
+                    std::vector<AlignedBuffer*> memory_buffers;
+                    AlignedBuffer* scratchpad_buffer = nullptr;
+                    size_t owner_ctx = 0;
+                    bool in_use = false;
+                };
+
+                /// \brief Check out a free context without taking a lock. The calling thread's
+                ///        previous context is tried first; the caller only blocks when every
+                ///        context is busy.
+                size_t acquire_context();
+                void release_context(size_t id);
+                bool try_acquire_context(size_t id);
+
+                /// \brief Hand context id a buffer set from the shared pool, preferring the one
+                ///        it used last.
+                void acquire_buffer_set(size_t id);
+                void release_buffer_set(size_t id);
+                /// \brief Bytes of the DNNL objects context id built for itself
+                size_t get_dnnl_context_bytes(size_t id) const;
+
                 std::shared_ptr<CPU_ExternalFunction> m_external_function;
 
+                size_t m_num_ctx = 1;
+                // one busy flag per context, claimed with compare-and-swap
+                std::unique_ptr<std::atomic<bool>[]> m_ctx_busy;
+                // input tensors of the last call on each context, only touched by the
+                // context's holder
+                std::vector<std::vector<const runtime::Tensor*>> m_ctx_last_inputs;
+                // callers waiting for a context once all of them are busy
+                std::atomic<size_t> m_num_waiters{0};
                 std::mutex m_mutex;
                 std::condition_variable m_cv;
-                volatile size_t m_num_ctx_available = 0;
-                size_t m_prev_ctx = 0;
-                size_t m_num_ctx = 1;
-                std::unordered_map<size_t, bool> m_id_pool;
                 std::vector<CPURuntimeContext*> m_ctx_vec;
+                // context of the last call, whose op durations make the NGRAPH_CPU_TRACING
+                // timeline
+                std::atomic<size_t> m_timeline_ctx{std::numeric_limits<size_t>::max()};
+
+                // NGRAPH_CPU_SHARED_CONTEXT_MEMORY: contexts draw their temporary pools and
+                // scratchpads from m_buffer_sets, which only grows to the number of calls
+                // actually running at the same time
+                bool m_shared_memory = false;
+                runtime::Allocator* m_allocator = nullptr;
+                std::mutex m_buffer_set_mutex;
+                std::vector<std::unique_ptr<BufferSet>> m_buffer_sets;
+                std::vector<size_t> m_ctx_buffer_set;
 
                 // Codegen specific
 
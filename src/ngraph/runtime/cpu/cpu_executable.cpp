@@ -14,13 +14,17 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <sstream>
+
 #if defined(NGRAPH_TBB_ENABLE)
 #include <tbb/tbb_stddef.h>
 #endif
 
 #include "cpu_backend_visibility.h"
 
+#include "ngraph/cpio.hpp"
 #include "ngraph/env_util.hpp"
+#include "ngraph/factory.hpp"
 #include "ngraph/graph_util.hpp"
 #include "ngraph/log.hpp"
 #include "ngraph/runtime/backend_manager.hpp"
@@ -30,7 +34,9 @@
 #include "ngraph/runtime/cpu/cpu_executable.hpp"
 #include "ngraph/runtime/cpu/cpu_external_function.hpp"
 #include "ngraph/runtime/cpu/cpu_tensor.hpp"
+#include "ngraph/runtime/cpu/dnnl_utils.hpp"
 #include "ngraph/runtime/cpu/static_initialize.hpp"
+#include "ngraph/serializer.hpp"
 #include "ngraph/util.hpp"
 
 #ifdef NGRAPH_CPU_MLIR_ENABLE
@@ -46,6 +52,9 @@ runtime::cpu::CPU_Executable::CPU_Executable(shared_ptr<Function> func,
                                              Allocator* allocator,
                                              bool performance_counters_enabled,
                                              EXECUTION_MODE mode)
+    : m_function(func)
+    , m_pass_config(pass_config)
+    , m_performance_counters_enabled(performance_counters_enabled)
 {
     m_external_function = make_shared<CPU_ExternalFunction>(func, mode);
     m_external_function->m_emit_timing = performance_counters_enabled;
@@ -55,11 +64,77 @@ runtime::cpu::CPU_Executable::CPU_Executable(shared_ptr<Function> func,
     set_parameters_and_results(*func);
 }
 
+runtime::cpu::CPU_Executable::CPU_Executable(shared_ptr<Function> func,
+                                             const string& pass_state,
+                                             ngraph::pass::PassConfig& pass_config,
+                                             Allocator* allocator,
+                                             bool performance_counters_enabled)
+    : m_function(func)
+    , m_pass_config(pass_config)
+    , m_performance_counters_enabled(performance_counters_enabled)
+{
+    m_external_function =
+        make_shared<CPU_ExternalFunction>(func, EXECUTION_MODE::DIRECT_EXECUTION);
+    m_external_function->m_emit_timing = performance_counters_enabled;
+    m_external_function->restore_pass_state(pass_state);
+    auto cf = m_external_function->make_call_frame(pass_config, allocator);
+    m_call_frame = dynamic_pointer_cast<CPU_CallFrame>(cf);
+
+    set_parameters_and_results(*func);
+}
+
+string runtime::cpu::CPU_Executable::get_save_info()
+{
+    return "CPU Save File 1.1, " + dnnl_utils::get_build_signature();
+}
+
+void runtime::cpu::CPU_Executable::save(ostream& out)
+{
+    if (!m_external_function->is_direct_execution())
+    {
+        throw ngraph_error("CPU backend: only direct execution executables can be saved");
+    }
+    for (auto& node : m_function->get_ops())
+    {
+        if (!FactoryRegistry<Node>::get().has_factory(node->get_type_info()))
+        {
+            throw ngraph_error("CPU backend: cannot save an executable containing " +
+                               node->description());
+        }
+    }
+
+    cpio::Writer writer(out);
+    string si = get_save_info();
+    writer.write("save_info", si.data(), si.size());
+    string model = serialize_with_output_shapes(m_function);
+    writer.write("model", model.data(), model.size());
+    string pass_state = m_external_function->save_pass_state(*m_function);
+    writer.write("pass_state", pass_state.data(), pass_state.size());
+
+    stringstream config;
+    config << "performance_counters " << m_performance_counters_enabled << "\n";
+    for (auto& enable : m_pass_config.get_enables())
+    {
+        config << "enable " << enable.first << " " << enable.second << "\n";
+    }
+    for (auto& attribute : m_pass_config.get_pass_attributes())
+    {
+        config << "attribute " << attribute.first << " " << attribute.second << "\n";
+    }
+    string pass_config = config.str();
+    writer.write("pass_config", pass_config.data(), pass_config.size());
+}
+
 std::shared_ptr<ngraph::runtime::cpu::CPU_CallFrame> runtime::cpu::CPU_Executable::get_call_frame()
 {
     return m_call_frame;
 }
 
+runtime::cpu::CPUMemoryUsage runtime::cpu::CPU_Executable::get_memory_usage()
+{
+    return m_call_frame->get_memory_usage();
+}
+
 bool runtime::cpu::CPU_Executable::call(const vector<shared_ptr<runtime::Tensor>>& outputs,
                                         const vector<shared_ptr<runtime::Tensor>>& inputs)
 {
@@ -71,13 +146,14 @@ bool runtime::cpu::CPU_Executable::call(const vector<shared_ptr<runtime::Tensor>
 void runtime::cpu::CPU_Backend::remove_compiled_function(shared_ptr<Executable> exec)
 {
     std::lock_guard<std::mutex> guard(m_exec_map_mutex);
-    for (auto it = m_exec_map.begin(); it != m_exec_map.end(); ++it)
+    // Structurally identical functions share one executable, so it may be mapped more than once
+    for (auto it = m_exec_map.begin(); it != m_exec_map.end();)
     {
-        if (it->second == exec)
-        {
-            m_exec_map.erase(it);
-            break;
-        }
+        it = (it->second == exec) ? m_exec_map.erase(it) : next(it);
+    }
+    for (auto it = m_structural_exec_map.begin(); it != m_structural_exec_map.end();)
+    {
+        it = (it->second == exec) ? m_structural_exec_map.erase(it) : next(it);
     }
 }
 
@@ -104,12 +180,25 @@ void runtime::cpu::CPU_Backend::set_host_memory_allocator(Allocator* allocator)
 
 vector<runtime::PerformanceCounter> runtime::cpu::CPU_Executable::get_performance_data() const
 {
-    vector<runtime::PerformanceCounter> rc;
-    rc.insert(rc.end(),
-              m_external_function->get_perf_counters().begin(),
-              m_external_function->get_perf_counters().end());
-    return rc;
+    return m_external_function->get_perf_counters();
+}
+
+vector<runtime::cpu::OpStats> runtime::cpu::CPU_Executable::get_op_stats() const
+{
+    return m_external_function->get_op_counters().get_stats();
+}
+
+void runtime::cpu::CPU_Executable::reset_op_stats()
+{
+    m_external_function->get_op_counters().reset();
+}
+
+#if defined(NGRAPH_TBB_ENABLE)
+vector<uint64_t> runtime::cpu::CPU_Executable::get_op_priorities() const
+{
+    return m_external_function->get_op_priorities();
 }
+#endif
 
 shared_ptr<ngraph::op::v0::Parameter>
     runtime::cpu::CPU_Executable::get_parameter(size_t index) const
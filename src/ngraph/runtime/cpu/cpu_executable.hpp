@@ -19,11 +19,13 @@
 #include <map>
 #include <memory>
 #include <mutex>
+#include <string>
 
 #include "cpu_backend_visibility.h"
 #include "ngraph/pass/pass_config.hpp"
 #include "ngraph/runtime/allocator.hpp"
 #include "ngraph/runtime/cpu/cpu_execution_mode.hpp"
+#include "ngraph/runtime/cpu/cpu_op_counters.hpp"
 #include "ngraph/runtime/executable.hpp"
 
 namespace ngraph
@@ -34,6 +36,7 @@ namespace ngraph
         {
             class CPU_ExternalFunction;
             class CPU_CallFrame;
+            struct CPUMemoryUsage;
 
             class CPU_BACKEND_API CPU_Executable : public runtime::Executable
             {
@@ -43,13 +46,49 @@ namespace ngraph
                                Allocator* allocator,
                                bool performance_counters_enabled,
                                EXECUTION_MODE mode);
+                /// \brief Rebuilds an executable written by save() without rerunning the CPU
+                ///        passes.
+                /// \param func The deserialized post-pass function
+                /// \param pass_state The pass results written by
+                ///        CPU_ExternalFunction::save_pass_state
+                CPU_Executable(std::shared_ptr<Function> func,
+                               const std::string& pass_state,
+                               ngraph::pass::PassConfig& pass_config,
+                               Allocator* allocator,
+                               bool performance_counters_enabled);
                 bool call(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
                           const std::vector<std::shared_ptr<runtime::Tensor>>& inputs) override;
 
                 std::shared_ptr<CPU_CallFrame> get_call_frame();
 
+                /// \brief Memory held by this executable, split into the part shared by all
+                ///        concurrent contexts and the part each context holds on its own.
+                ///        Memory owned by DNNL is not included, see CPUMemoryUsage.
+                CPUMemoryUsage get_memory_usage();
+
                 std::vector<PerformanceCounter> get_performance_data() const override;
 
+                /// \brief Per-op call counts and latency histograms since the last
+                ///        reset_op_stats(), merged over all concurrent contexts. Only filled in
+                ///        by direct execution, where they are always collected.
+                std::vector<OpStats> get_op_stats() const;
+                /// \brief Starts the per-op counters over without waiting for calls in flight
+                void reset_op_stats();
+#if defined(NGRAPH_TBB_ENABLE)
+                /// \brief Critical path priorities the TBB executor picks ready ops by, in the
+                ///        order of get_op_stats(). Empty without the TBB executor.
+                std::vector<uint64_t> get_op_priorities() const;
+#endif
+
+                /// \brief Saves the function as it is after the CPU passes, together with the
+                ///        layouts, memory assignment and annotations the passes produced.
+                ///        Load with CPU_Backend::load.
+                void save(std::ostream& output_stream) override;
+                /// \brief The save_info entry of files written by save(). It holds
+                ///        dnnl_utils::get_build_signature(), so a file is only loaded by the
+                ///        build that wrote it, on the same instruction set.
+                static std::string get_save_info();
+
                 std::shared_ptr<runtime::Tensor> create_input_tensor(size_t input_index) override;
 
                 std::shared_ptr<runtime::Tensor> create_input_tensor(size_t input_index,
@@ -82,6 +121,10 @@ namespace ngraph
 
                 std::shared_ptr<CPU_ExternalFunction> m_external_function;
                 std::shared_ptr<CPU_CallFrame> m_call_frame;
+                // The post-pass function; the external function drops its reference once built
+                std::shared_ptr<Function> m_function;
+                ngraph::pass::PassConfig m_pass_config;
+                bool m_performance_counters_enabled;
             };
         }
     }
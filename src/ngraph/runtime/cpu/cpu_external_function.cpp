@@ -14,21 +14,18 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
 #include <cstdlib>
 #include <fstream>
+#include <limits>
 #include <memory>
+#include <sstream>
 #include <string>
 #include <tuple>
 #include <typeindex>
 #include <typeinfo>
 #include <unordered_map>
 
-#if defined(NGRAPH_TBB_ENABLE)
-#define TBB_PREVIEW_FLOW_GRAPH_TRACE 1
-
-#include <tbb/flow_graph.h>
-#endif
-
 #if defined(CODEGEN_ENABLE)
 #include "ngraph/code_writer.hpp"
 #include "ngraph/codegen/compiler.hpp"
@@ -274,6 +271,11 @@ public:
 
 static const string s_debug_dir = "cpu_codegen";
 
+#if defined(NGRAPH_TBB_ENABLE)
+// Calls timed before the measured latencies replace the estimated op costs
+static const size_t s_op_priority_warmup_calls = 8;
+#endif
+
 #if defined(CODEGEN_ENABLE)
 
 static string emit_string_array(const vector<string>& s, size_t max_line_length)
@@ -1462,11 +1464,13 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
     }
 
 #if defined(NGRAPH_TBB_ENABLE)
-    if (m_use_tbb && (runtime::cpu::IsTracingEnabled() || m_emit_timing))
+    // Op counters are per op, so only the sequential timeline is thrown off by ops that run
+    // at the same time
+    if (m_use_tbb && runtime::cpu::IsTracingEnabled())
     {
         throw ngraph_error(
-            "CPU Backend: Tracing and performance breakdowns might not be accurate with TBB "
-            "enabled due to concurrent graph execution");
+            "CPU Backend: Tracing might not be accurate with TBB enabled due to concurrent graph "
+            "execution");
     }
 #endif
 
@@ -1479,8 +1483,11 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
         // Enable per_pass_validation if required for debug purpose
         pass_manager.set_per_pass_validation(false);
     }
-    register_common_passes(pass_manager, pass_config);
-    pass_manager.run_passes(m_function, false);
+    if (!m_passes_done)
+    {
+        register_common_passes(pass_manager, pass_config);
+        pass_manager.run_passes(m_function, false);
+    }
 
     static runtime::cpu::CPU_DebugTracer debug_tracer;
     if (getenv_bool("NGRAPH_CPU_DEBUG_TRACER"))
@@ -1557,6 +1564,7 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
                 buffer_index,
                 const_cast<void*>(
                     static_pointer_cast<ngraph::op::v0::Constant>(node)->get_data_ptr()));
+            m_constant_pool_size += output_tensor->size();
             auto tensor_set = get_tensor_set(output_tensor);
             // process all tensors in the set containing the output tensor of the constant
             for (auto& ele_t : tensor_set)
@@ -1618,6 +1626,7 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
     // After processing inputs, outputs, constants, and intermediates, set the buffer size.
     m_buffer_size = buffer_index;
 
+    vector<shared_ptr<const Node>> counted_ops;
     for (shared_ptr<Node> node : m_function->get_ordered_ops())
     {
         if (node->is_parameter() || node->is_constant())
@@ -1730,10 +1739,16 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
         }
 
         enables.emplace_back(enable);
-        enable_nodename_list.emplace_back(make_pair(enable, node->get_name()));
 
-        m_perf_counters.emplace_back(node, 0, 0);
+        counted_ops.push_back(node);
     }
+#if defined(NGRAPH_TBB_ENABLE)
+    if (m_use_tbb)
+    {
+        build_op_graph(counted_ops);
+    }
+#endif
+    m_op_counters.set_ops(move(counted_ops));
 
     if (getenv_bool("NGRAPH_DEX_DEBUG"))
     {
@@ -1799,10 +1814,9 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
     NGRAPH_CHECK(m_op_attrs.size() == functors.size());
 
     executor = [&](CPURuntimeContext* ctx, vector<void*>& inputs, vector<void*>& outputs) {
-        cpu::Timestamp start_ts, end_ts;
         uint64_t profiler_count = 0;
 
-        if (ctx->first_iteration)
+        if (ctx->first_iteration || ctx->buffers_rebound)
         {
             for (auto& p : intermediates_offsets)
             {
@@ -1827,109 +1841,30 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
             ctx->buffer_data[get<0>(p)] = static_cast<uint8_t*>(outputs[get<1>(p)]) + get<2>(p);
         }
 
-        auto functor = functors.begin();
 #if defined(NGRAPH_TBB_ENABLE)
         if (m_use_tbb)
         {
-            // Build the flow graph
-            if (ctx->first_iteration)
+            m_op_graph->run(ctx->op_pending, [this, ctx](size_t index, int arena) {
+                execute_op(ctx, index, arena);
+            });
+
+            // Once enough calls were timed, prioritize by the measured latencies instead of
+            // the estimates, and keep following them as the calls double
+            size_t calls = m_op_graph_calls.fetch_add(1, std::memory_order_relaxed) + 1;
+            if (calls >= s_op_priority_warmup_calls && (calls & (calls - 1)) == 0)
             {
-                std::unordered_map<std::string, tbb::flow::continue_node<tbb::flow::continue_msg>*>
-                    nodename_tbbnode_map;
-                tbb::flow::continue_node<tbb::flow::continue_msg>* flowgraph_node_start =
-                    new tbb::flow::continue_node<tbb::flow::continue_msg>(
-                        *(ctx->G), [&](const tbb::flow::continue_msg& /* msg */) {});
-                auto it = enable_nodename_list.begin();
-                for (const auto& p : enables)
+                vector<uint64_t> costs;
+                uint64_t timed_runs = 0;
+                for (const OpStats& stats : m_op_counters.get_stats())
                 {
-                    auto index = profiler_count++;
-                    tbb::flow::continue_node<tbb::flow::continue_msg>* flowgraph_node =
-                        new tbb::flow::continue_node<tbb::flow::continue_msg>(
-                            *(ctx->G),
-                            [&, functor, index](const tbb::flow::continue_msg& /* msg */) {
-                                if (p(ctx) || ctx->first_iteration)
-                                {
-                                    if (runtime::cpu::IsTracingEnabled() || m_emit_timing)
-                                    {
-                                        start_ts = cpu::Clock::now();
-                                    }
-                                    CPUExecutionContext ectx{0};
-                                    executor::GetCPUExecutor().execute(*functor, ctx, &ectx, true);
-                                    if (runtime::cpu::IsTracingEnabled() || m_emit_timing)
-                                    {
-                                        end_ts = cpu::Clock::now();
-
-                                        if (runtime::cpu::IsTracingEnabled())
-                                        {
-                                            ctx->op_durations[index] =
-                                                (std::chrono::duration_cast<cpu::Timescale>(
-                                                     end_ts - start_ts))
-                                                    .count();
-                                        }
-                                        if (m_emit_timing)
-                                        {
-                                            m_perf_counters[index].m_total_microseconds +=
-                                                std::chrono::duration_cast<
-                                                    std::chrono::microseconds>(end_ts - start_ts)
-                                                    .count();
-                                            m_perf_counters[index].m_call_count++;
-                                        }
-                                    }
-                                }
-                                else
-                                {
-                                    if (runtime::cpu::IsTracingEnabled())
-                                    {
-                                        ctx->op_durations[index] = 0;
-                                    }
-                                    if (m_emit_timing)
-                                    {
-                                        m_perf_counters[index].m_call_count++;
-                                    }
-                                }
-                            });
-#ifdef TBB_PREVIEW_FLOW_GRAPH_TRACE
-                    flowgraph_node->set_name(it->second.c_str());
-#endif
-                    std::advance(functor, 1);
-                    nodename_tbbnode_map.insert({it->second, flowgraph_node});
-                    it++;
+                    uint64_t runs = stats.m_latency.get_count();
+                    costs.push_back(runs == 0 ? 0 : stats.m_total_nanoseconds / runs);
+                    timed_runs += runs;
+                }
+                if (timed_runs > 0)
+                {
+                    m_op_graph->update_priorities(costs);
                 }
-
-                traverse_nodes(
-                    m_function, [&flowgraph_node_start, &nodename_tbbnode_map](shared_ptr<Node> n) {
-                        if (!n->is_parameter() && !n->is_constant())
-                        {
-                            bool is_head = true;
-                            for (auto arg : n->get_arguments())
-                            {
-                                if (!arg->is_parameter() && !arg->is_constant())
-                                {
-                                    is_head = false;
-                                    tbb::flow::make_edge(*(nodename_tbbnode_map[arg->get_name()]),
-                                                         *(nodename_tbbnode_map[n->get_name()]));
-                                }
-                            }
-                            if (is_head)
-                            {
-                                tbb::flow::make_edge(*flowgraph_node_start,
-                                                     *(nodename_tbbnode_map[n->get_name()]));
-                            }
-                        }
-                    });
-
-                release_function();
-            }
-            // Execute the flow graph
-            (static_cast<tbb::flow::continue_node<tbb::flow::continue_msg>*>(&(*(ctx->G->begin()))))
-                ->try_put(tbb::flow::continue_msg());
-            try
-            {
-                ctx->G->wait_for_all();
-            }
-            catch (...)
-            {
-                throw;
             }
         }
         else
@@ -1968,16 +1903,10 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
             for (; ctx->pc < functors.size(); ctx->pc++)
             {
                 auto index = profiler_count++;
-                if ((enables.at(ctx->pc))(ctx) || ctx->first_iteration)
+                if ((enables.at(ctx->pc))(ctx) || ctx->first_iteration || ctx->buffers_rebound)
                 {
-                    // Each Op will have exactly one functor, start the clock before the exceution
-                    // of functor
-                    // and collect the profiler_count once the execution complets
-                    if (runtime::cpu::IsTracingEnabled() || m_emit_timing)
-                    {
-                        start_ts = cpu::Clock::now();
-                    }
-
+                    // Each Op has exactly one functor, timed on its own so that the debug
+                    // tracer's dumps are not counted
                     CPUExecutionContext ectx{0};
 
                     if (debug_tracer.tracing_is_enabled())
@@ -1985,7 +1914,21 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
                         this->dump_one_kernel(debug_tracer, ctx, true);
                     }
 
+                    auto start_ts = cpu::Clock::now();
                     executor::GetCPUExecutor().execute(functors.at(ctx->pc), ctx, &ectx);
+                    auto end_ts = cpu::Clock::now();
+
+                    if (runtime::cpu::IsTracingEnabled())
+                    {
+                        ctx->op_durations[index] =
+                            (std::chrono::duration_cast<cpu::Timescale>(end_ts - start_ts))
+                                .count();
+                    }
+                    // A call resumed from a breakpoint starts counting its ops from pc
+                    ctx->op_counters->record(
+                        ctx->pc,
+                        std::chrono::duration_cast<std::chrono::nanoseconds>(end_ts - start_ts)
+                            .count());
 
                     if (debug_tracer.tracing_is_enabled())
                     {
@@ -1997,26 +1940,6 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
                         ctx->pc++;
                         break;
                     }
-
-                    if (runtime::cpu::IsTracingEnabled() || m_emit_timing)
-                    {
-                        end_ts = cpu::Clock::now();
-
-                        if (runtime::cpu::IsTracingEnabled())
-                        {
-                            ctx->op_durations[index] =
-                                (std::chrono::duration_cast<cpu::Timescale>(end_ts - start_ts))
-                                    .count();
-                        }
-                        if (m_emit_timing)
-                        {
-                            m_perf_counters[index].m_total_microseconds +=
-                                std::chrono::duration_cast<std::chrono::microseconds>(end_ts -
-                                                                                      start_ts)
-                                    .count();
-                            m_perf_counters[index].m_call_count++;
-                        }
-                    }
                 }
                 else
                 {
@@ -2024,14 +1947,12 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
                     {
                         ctx->op_durations[index] = 0;
                     }
-                    if (m_emit_timing)
-                    {
-                        m_perf_counters[index].m_call_count++;
-                    }
+                    ctx->op_counters->record_skipped(ctx->pc);
                 }
             }
         }
         ctx->first_iteration = false;
+        ctx->buffers_rebound = false;
         if (runtime::cpu::IsTracingEnabled())
         {
             NGRAPH_CHECK(m_op_attrs.size() == profiler_count);
@@ -2039,14 +1960,124 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
     };
 
     m_is_built = true;
+    release_function();
+}
 
 #if defined(NGRAPH_TBB_ENABLE)
-    if (!m_use_tbb)
-#endif
+// Work of an op before any of its runs were timed: the bytes it reads and writes, plus the
+// multiply-accumulates of the contractions that dominate most models
+static uint64_t estimate_op_cost(const Node& node)
+{
+    uint64_t cost = 0;
+    for (auto& input : node.inputs())
     {
-        release_function();
+        cost += shape_size(input.get_shape()) * input.get_element_type().size();
+    }
+    for (auto& output : node.outputs())
+    {
+        cost += shape_size(output.get_shape()) * output.get_element_type().size();
+    }
+    if (node.get_output_size() == 0)
+    {
+        return cost;
+    }
+
+    uint64_t output_size = shape_size(node.get_output_shape(0));
+    if (auto dot = as_type<const ngraph::op::v0::Dot>(&node))
+    {
+        const Shape& shape = node.get_input_shape(0);
+        cost += output_size *
+                shape_size(Shape(shape.end() - dot->get_reduction_axes_count(), shape.end()));
+    }
+    else if (auto matmul = as_type<const ngraph::op::MatmulBias>(&node))
+    {
+        const Shape& shape = node.get_input_shape(0);
+        cost += output_size * (matmul->get_is_a_transposed() ? shape.at(0) : shape.at(1));
+    }
+    else if (is_type<const ngraph::op::v0::Convolution>(&node) ||
+             is_type<const ngraph::op::v0::ConvolutionBias>(&node) ||
+             is_type<const ngraph::op::v0::ConvolutionBiasAdd>(&node) ||
+             is_type<const ngraph::op::ConvolutionRelu>(&node) ||
+             is_type<const ngraph::op::ConvolutionAdd>(&node) ||
+             is_type<const ngraph::op::GroupConvolutionBias>(&node))
+    {
+        // Every output element takes one filter's worth of products
+        const Shape& filters = node.get_input_shape(1);
+        cost += output_size * shape_size(filters) / max<size_t>(filters.at(0), 1);
+    }
+    return cost;
+}
+
+void runtime::cpu::CPU_ExternalFunction::build_op_graph(const vector<shared_ptr<const Node>>& ops)
+{
+    unordered_map<const Node*, size_t> op_index;
+    for (size_t i = 0; i < ops.size(); i++)
+    {
+        op_index[ops[i].get()] = i;
+    }
+
+    // Ops each functor waits for; parameters and constants have no functor to wait for
+    vector<vector<size_t>> predecessors(ops.size());
+    for (size_t i = 0; i < ops.size(); i++)
+    {
+        auto add_predecessor = [&](const Node* node) {
+            auto it = op_index.find(node);
+            if (it != op_index.end() &&
+                find(predecessors[i].begin(), predecessors[i].end(), it->second) ==
+                    predecessors[i].end())
+            {
+                predecessors[i].push_back(it->second);
+            }
+        };
+        for (auto& input : ops[i]->inputs())
+        {
+            add_predecessor(input.get_source_output().get_node());
+        }
+        for (auto& dependency : ops[i]->get_control_dependencies())
+        {
+            add_predecessor(dependency.get());
+        }
+    }
+
+    vector<uint64_t> costs;
+    m_op_uses_dnnl.clear();
+    for (auto& op : ops)
+    {
+        costs.push_back(estimate_op_cost(*op));
+        m_op_uses_dnnl.push_back(dnnl_utils::use_dnnl_kernel(op.get()));
+    }
+    m_op_graph.reset(new OpGraph(predecessors, costs));
+    m_op_graph_calls.store(0, std::memory_order_relaxed);
+}
+
+vector<uint64_t> runtime::cpu::CPU_ExternalFunction::get_op_priorities() const
+{
+    return m_op_graph ? m_op_graph->get_priorities() : vector<uint64_t>();
+}
+
+void runtime::cpu::CPU_ExternalFunction::execute_op(CPURuntimeContext* ctx,
+                                                    size_t index,
+                                                    int arena)
+{
+    if (enables[index](ctx) || ctx->first_iteration || ctx->buffers_rebound)
+    {
+        // Chains running at the same time use different thread pools, so that each gets its
+        // share of the intra-op threads. DNNL primitives all use the scratchpad of the
+        // context, so they stay on the first arena, which runs one functor at a time.
+        CPUExecutionContext ectx{
+            m_op_uses_dnnl[index] ? 0 : arena % executor::GetCPUExecutor().get_num_thread_pools()};
+        auto start_ts = cpu::Clock::now();
+        executor::GetCPUExecutor().execute(functors[index], ctx, &ectx, true);
+        auto end_ts = cpu::Clock::now();
+        ctx->op_counters->record(
+            index, std::chrono::duration_cast<std::chrono::nanoseconds>(end_ts - start_ts).count());
+    }
+    else
+    {
+        ctx->op_counters->record_skipped(index);
     }
 }
+#endif
 
 size_t runtime::cpu::CPU_ExternalFunction::get_buffer_index(const std::string& name)
 {
@@ -2118,8 +2149,17 @@ const runtime::cpu::LayoutDescriptorPtrs&
     return result_layout_descriptors;
 }
 
-const vector<runtime::PerformanceCounter>& runtime::cpu::CPU_ExternalFunction::get_perf_counters()
+vector<runtime::PerformanceCounter> runtime::cpu::CPU_ExternalFunction::get_perf_counters()
 {
+    if (m_direct_execution)
+    {
+        vector<runtime::PerformanceCounter> rc;
+        for (const OpStats& stats : m_op_counters.get_stats())
+        {
+            rc.emplace_back(stats.m_node, stats.m_total_nanoseconds / 1000, stats.m_call_count);
+        }
+        return rc;
+    }
 #if defined(CODEGEN_ENABLE)
     // Codegen. Retrieve perf counters from compiled module
     if (m_execution_engine)
@@ -2321,3 +2361,240 @@ std::unordered_set<descriptor::Tensor*>&
     NGRAPH_CHECK(output_buffer_it != bufferID_to_tensorSets.end());
     return output_buffer_it->second.second;
 }
+
+namespace
+{
+    // Native-endian encoding used by save_pass_state. Saved executables are only meant to be
+    // loaded by the same build of the backend on the same kind of machine.
+    void write_value(ostream& out, uint64_t value)
+    {
+        out.write(reinterpret_cast<const char*>(&value), sizeof(value));
+    }
+
+    uint64_t read_value(istream& in)
+    {
+        uint64_t value;
+        in.read(reinterpret_cast<char*>(&value), sizeof(value));
+        if (!in)
+        {
+            throw ngraph_error("CPU backend: saved pass state is truncated");
+        }
+        return value;
+    }
+
+    enum class SavedAnnotations : uint64_t
+    {
+        NONE,
+        OP,
+        CPU
+    };
+}
+
+string runtime::cpu::CPU_ExternalFunction::save_pass_state(const Function& func) const
+{
+    stringstream out;
+    // DNNL memory descriptors are saved verbatim, so they can only be read back by the same
+    // DNNL release
+    const dnnl_version_t* version = dnnl_version();
+    write_value(out, sizeof(dnnl_memory_desc_t));
+    write_value(out, version->major);
+    write_value(out, version->minor);
+
+    auto ops = func.get_ordered_ops();
+    unordered_map<const descriptor::Tensor*, pair<size_t, size_t>> tensor_index;
+    write_value(out, ops.size());
+    for (size_t op_index = 0; op_index < ops.size(); ++op_index)
+    {
+        auto& node = ops[op_index];
+        // The serialized model only keeps as many elements as the shape of a constant holds,
+        // which leaves out the padding of weights prepacked into a padded DNNL layout
+        size_t prepacked_size = 0;
+        if (auto constant = as_type_ptr<ngraph::op::v0::Constant>(node))
+        {
+            auto& tensor = constant->get_output_tensor(0);
+            auto layout = static_pointer_cast<LayoutDescriptor>(tensor.get_tensor_layout());
+            if (layout && layout->is_dnnl_layout() &&
+                layout->get_allocated_size() >
+                    shape_size(tensor.get_shape()) * tensor.get_element_type().size())
+            {
+                prepacked_size = layout->get_allocated_size();
+            }
+        }
+        write_value(out, prepacked_size);
+        if (prepacked_size > 0)
+        {
+            out.write(static_cast<const char*>(
+                          static_pointer_cast<ngraph::op::v0::Constant>(node)->get_data_ptr()),
+                      prepacked_size);
+        }
+
+        auto annotations = node->is_op() ? node->get_op_annotations() : nullptr;
+        auto cpu_annotations = dynamic_pointer_cast<CPUOpAnnotations>(annotations);
+        if (!annotations)
+        {
+            write_value(out, static_cast<uint64_t>(SavedAnnotations::NONE));
+        }
+        else
+        {
+            write_value(out,
+                        static_cast<uint64_t>(cpu_annotations ? SavedAnnotations::CPU
+                                                              : SavedAnnotations::OP));
+            write_value(out, annotations->is_cacheable());
+            write_value(out, cpu_annotations && cpu_annotations->is_dnnl_op());
+            auto& oi_pairs = annotations->get_in_place_oi_pairs();
+            write_value(out, oi_pairs.size());
+            for (auto& oi_pair : oi_pairs)
+            {
+                write_value(out, oi_pair.output);
+                write_value(out, oi_pair.input);
+                write_value(out, oi_pair.destructive);
+            }
+        }
+
+        write_value(out, node->get_output_size());
+        for (size_t i = 0; i < node->get_output_size(); ++i)
+        {
+            auto& tensor = node->get_output_tensor(i);
+            tensor_index[&tensor] = make_pair(op_index, i);
+            write_value(out, tensor.get_pool_offset());
+            auto layout = static_pointer_cast<LayoutDescriptor>(tensor.get_tensor_layout());
+            write_value(out, layout != nullptr);
+            if (layout)
+            {
+                write_value(out, layout->is_dnnl_layout());
+                if (layout->is_dnnl_layout())
+                {
+                    out.write(reinterpret_cast<const char*>(&layout->get_dnnl_md().data),
+                              sizeof(dnnl_memory_desc_t));
+                }
+            }
+        }
+    }
+
+    write_value(out, const_cast<Function&>(func).get_temporary_pool_size());
+    write_value(out, bufferID_to_tensorSets.size());
+    for (auto& buffer : bufferID_to_tensorSets)
+    {
+        write_value(out, buffer.first);
+        write_value(out, static_cast<uint64_t>(buffer.second.first));
+        write_value(out, buffer.second.second.size());
+        for (auto tensor : buffer.second.second)
+        {
+            auto& index = tensor_index.at(tensor);
+            write_value(out, index.first);
+            write_value(out, index.second);
+        }
+    }
+    return out.str();
+}
+
+void runtime::cpu::CPU_ExternalFunction::restore_pass_state(const string& state)
+{
+    stringstream in(state);
+    const dnnl_version_t* version = dnnl_version();
+    if (read_value(in) != sizeof(dnnl_memory_desc_t) || read_value(in) != version->major ||
+        read_value(in) != version->minor)
+    {
+        throw ngraph_error("CPU backend: executable was saved with a different DNNL version");
+    }
+
+    auto ops = m_function->get_ordered_ops();
+    if (read_value(in) != ops.size())
+    {
+        throw ngraph_error("CPU backend: saved pass state does not match the saved function");
+    }
+    for (auto& node : ops)
+    {
+        size_t prepacked_size = read_value(in);
+        if (prepacked_size > 0)
+        {
+            auto constant = as_type_ptr<ngraph::op::v0::Constant>(node);
+            if (!constant)
+            {
+                throw ngraph_error(
+                    "CPU backend: saved pass state does not match the saved function");
+            }
+            auto data = make_shared<AlignedBuffer>(prepacked_size);
+            if (!in.read(static_cast<char*>(data->get_ptr()), prepacked_size))
+            {
+                throw ngraph_error("CPU backend: saved pass state is truncated");
+            }
+            auto prepacked = make_shared<ngraph::op::v0::Constant>(
+                constant->get_output_element_type(0), constant->get_output_shape(0), data);
+            replace_node(node, prepacked);
+            node = prepacked;
+        }
+
+        auto annotations_kind = static_cast<SavedAnnotations>(read_value(in));
+        if (annotations_kind != SavedAnnotations::NONE)
+        {
+            bool cacheable = read_value(in);
+            bool dnnl_op = read_value(in);
+            shared_ptr<ngraph::op::util::OpAnnotations> annotations;
+            if (annotations_kind == SavedAnnotations::CPU)
+            {
+                auto cpu_annotations = make_shared<CPUOpAnnotations>();
+                cpu_annotations->set_dnnl_op(dnnl_op);
+                annotations = cpu_annotations;
+            }
+            else
+            {
+                annotations = make_shared<ngraph::op::util::OpAnnotations>();
+            }
+            annotations->set_cacheable(cacheable);
+            size_t oi_pair_count = read_value(in);
+            for (size_t i = 0; i < oi_pair_count; ++i)
+            {
+                ngraph::op::util::oi_pair oi_pair;
+                oi_pair.output = read_value(in);
+                oi_pair.input = read_value(in);
+                oi_pair.destructive = read_value(in);
+                annotations->add_in_place_oi_pair(oi_pair);
+            }
+            node->set_op_annotations(annotations);
+        }
+
+        if (read_value(in) != node->get_output_size())
+        {
+            throw ngraph_error("CPU backend: saved pass state does not match the saved function");
+        }
+        for (size_t i = 0; i < node->get_output_size(); ++i)
+        {
+            auto& tensor = node->get_output_tensor(i);
+            tensor.set_pool_offset(read_value(in));
+            if (read_value(in))
+            {
+                auto layout = make_shared<LayoutDescriptor>(tensor);
+                if (read_value(in))
+                {
+                    dnnl_memory_desc_t md;
+                    if (!in.read(reinterpret_cast<char*>(&md), sizeof(md)))
+                    {
+                        throw ngraph_error("CPU backend: saved pass state is truncated");
+                    }
+                    layout->set_dnnl_md(dnnl::memory::desc(md));
+                }
+                tensor.set_tensor_layout(layout);
+            }
+        }
+    }
+
+    m_function->set_temporary_pool_size(read_value(in));
+    size_t buffer_count = read_value(in);
+    for (size_t i = 0; i < buffer_count; ++i)
+    {
+        size_t buffer_id = read_value(in);
+        auto& buffer = bufferID_to_tensorSets[buffer_id];
+        buffer.first = static_cast<TensorRole>(read_value(in));
+        size_t tensor_count = read_value(in);
+        for (size_t j = 0; j < tensor_count; ++j)
+        {
+            size_t op_index = read_value(in);
+            size_t output_index = read_value(in);
+            auto tensor = &ops.at(op_index)->get_output_tensor(output_index);
+            buffer.second.insert(tensor);
+            tensor_to_bufferID[tensor] = buffer_id;
+        }
+    }
+    m_passes_done = true;
+}
@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <functional>
 #include <list>
 #include <map>
@@ -43,6 +44,8 @@
 #include "ngraph/runtime/cpu/cpu_debug_tracer.hpp"
 #include "ngraph/runtime/cpu/cpu_execution_mode.hpp"
 #include "ngraph/runtime/cpu/cpu_layout_descriptor.hpp"
+#include "ngraph/runtime/cpu/cpu_op_counters.hpp"
+#include "ngraph/runtime/cpu/cpu_op_graph.hpp"
 #include "ngraph/runtime/cpu/cpu_tensor_wrapper.hpp"
 #include "ngraph/runtime/cpu/dnnl_emitter.hpp"
 #include "ngraph/runtime/performance_counter.hpp"
@@ -128,6 +131,8 @@ namespace ngraph
                 {
                     return m_memory_buffer_sizes;
                 }
+                // bytes of constant data referenced in place by every context
+                size_t get_constant_pool_size() const { return m_constant_pool_size; }
                 const std::vector<OpAttributes>& get_op_attrs() const { return m_op_attrs; }
                 const std::unique_ptr<DNNLEmitter>& get_dnnl_emitter() const
                 {
@@ -179,7 +184,23 @@ namespace ngraph
                                    const std::string& directory,
                                    const std::string& filename);
 
-                const std::vector<PerformanceCounter>& get_perf_counters();
+                std::vector<PerformanceCounter> get_perf_counters();
+                /// \brief Per-op counters of direct execution, one shard per runtime context
+                OpCounters& get_op_counters() { return m_op_counters; }
+#if defined(NGRAPH_TBB_ENABLE)
+                /// \brief Priority of every functor of the TBB executor, the cost of the longest
+                ///        path from it to the end of the function. Empty without the TBB
+                ///        executor.
+                std::vector<uint64_t> get_op_priorities() const;
+#endif
+
+                /// \brief Serializes what the CPU passes attached to func, the post-pass function
+                ///        this external function was built from: op annotations, tensor layouts,
+                ///        pool offsets and buffer sets.
+                std::string save_pass_state(const Function& func) const;
+                /// \brief Restores state written by save_pass_state onto a deserialized copy of
+                ///        the post-pass function. build() then skips the CPU passes.
+                void restore_pass_state(const std::string& state);
 
             protected:
                 void build(ngraph::pass::PassConfig& pass_config);
@@ -203,6 +224,14 @@ namespace ngraph
 
                 bool computes_result(Node* node);
                 void release_function() { m_function = nullptr; }
+#if defined(NGRAPH_TBB_ENABLE)
+                /// \brief Finds the functors each functor has to wait for, from the data and
+                ///        control dependencies between their ops, and prioritizes them by
+                ///        estimated cost
+                void build_op_graph(const std::vector<std::shared_ptr<const Node>>& ops);
+                /// \brief Runs functor index on a thread pool of the arena
+                void execute_op(CPURuntimeContext* ctx, size_t index, int arena);
+#endif
 #if defined(CODEGEN_ENABLE)
                 void emit_debug_function_entry(CodeWriter& writer,
                                                Node* node,
@@ -244,6 +273,13 @@ namespace ngraph
 
 #if defined(NGRAPH_TBB_ENABLE)
                 bool m_use_tbb;
+                // Priorities are estimated at build time and refreshed from the measured
+                // latencies as calls come in
+                std::unique_ptr<OpGraph> m_op_graph;
+                // functors that run DNNL primitives, which all share the scratchpad of the
+                // runtime context
+                std::vector<bool> m_op_uses_dnnl;
+                std::atomic<size_t> m_op_graph_calls{0};
 #endif
 #if defined(CODEGEN_ENABLE)
                 bool m_is_compiled;
@@ -268,6 +304,7 @@ namespace ngraph
                 LayoutDescriptorPtrs parameter_layout_descriptors;
                 LayoutDescriptorPtrs result_layout_descriptors;
                 std::vector<size_t> m_memory_buffer_sizes;
+                size_t m_constant_pool_size = 0;
                 std::vector<OpAttributes> m_op_attrs;
 
                 std::unique_ptr<DNNLEmitter> m_dnnl_emitter;
@@ -277,8 +314,6 @@ namespace ngraph
                 std::vector<CPUKernelFunctor> functors;
                 std::vector<std::string> op_names;
                 std::vector<std::function<bool(CPURuntimeContext*)>> enables;
-                std::list<std::pair<std::function<bool(CPURuntimeContext*)>, std::string>>
-                    enable_nodename_list;
                 std::function<void(CPURuntimeContext*, std::vector<void*>&, std::vector<void*>&)>
                     executor;
                 // name of a tensor and index into the cpu_runtime_context's buffer_data vector to
@@ -319,7 +354,11 @@ namespace ngraph
                 size_t m_buffer_size = 0;
                 std::unordered_map<std::string, std::shared_ptr<CPU_ExternalFunction>> callees;
                 bool m_is_built;
+                // set when the function was loaded with its pass results already applied
+                bool m_passes_done = false;
+                // counters read back from the compiled module
                 std::vector<runtime::PerformanceCounter> m_perf_counters;
+                OpCounters m_op_counters;
 
                 /// Map each node with dnnl implementation to its dnnl primitive creating
                 /// string, deps, dnnl primitive index, and dnnl scratchpad size.
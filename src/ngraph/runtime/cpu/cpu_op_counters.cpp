@@ -0,0 +1,157 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <cmath>
+
+#include "ngraph/runtime/cpu/cpu_op_counters.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+constexpr size_t runtime::cpu::OpLatencyHistogram::bucket_count;
+
+size_t runtime::cpu::OpLatencyHistogram::get_bucket(uint64_t nanoseconds)
+{
+    if (nanoseconds < 8)
+    {
+        return nanoseconds;
+    }
+    // Position of the highest set bit, then the two bits below it pick the quarter
+    size_t msb = 0;
+    for (size_t shift = 32; shift > 0; shift /= 2)
+    {
+        if (nanoseconds >> (msb + shift))
+        {
+            msb += shift;
+        }
+    }
+    size_t quarter = (nanoseconds >> (msb - 2)) & 3;
+    return min(4 * (msb - 1) + quarter, bucket_count - 1);
+}
+
+uint64_t runtime::cpu::OpLatencyHistogram::get_lower_bound(size_t bucket)
+{
+    if (bucket < 8)
+    {
+        return bucket;
+    }
+    size_t msb = bucket / 4 + 1;
+    return (4 + bucket % 4) << (msb - 2);
+}
+
+uint64_t runtime::cpu::OpLatencyHistogram::get_count() const
+{
+    uint64_t count = 0;
+    for (uint64_t c : m_counts)
+    {
+        count += c;
+    }
+    return count;
+}
+
+uint64_t runtime::cpu::OpLatencyHistogram::get_percentile(double p) const
+{
+    uint64_t count = get_count();
+    if (count == 0)
+    {
+        return 0;
+    }
+    uint64_t rank = max<uint64_t>(1, static_cast<uint64_t>(ceil(p * count)));
+    uint64_t seen = 0;
+    size_t bucket = 0;
+    for (; bucket < bucket_count - 1; ++bucket)
+    {
+        seen += m_counts[bucket];
+        if (seen >= rank)
+        {
+            break;
+        }
+    }
+    // The middle of the bucket; the small buckets hold a single latency
+    uint64_t low = get_lower_bound(bucket);
+    return bucket < 8 ? low : (low + get_lower_bound(bucket + 1)) / 2;
+}
+
+runtime::cpu::OpCounterShard::OpCounterShard(size_t op_count)
+    : m_counters(new Counters[op_count])
+{
+}
+
+void runtime::cpu::OpCounterShard::accumulate(size_t index, OpStats& stats) const
+{
+    const Counters& c = m_counters[index];
+    stats.m_call_count += c.m_call_count.load(memory_order_relaxed);
+    stats.m_total_nanoseconds += c.m_total_nanoseconds.load(memory_order_relaxed);
+    for (size_t i = 0; i < OpLatencyHistogram::bucket_count; ++i)
+    {
+        stats.m_latency.m_counts[i] += c.m_buckets[i].load(memory_order_relaxed);
+    }
+}
+
+void runtime::cpu::OpCounters::set_ops(vector<shared_ptr<const Node>> ops)
+{
+    lock_guard<mutex> lock(m_mutex);
+    m_ops = move(ops);
+    m_shards.clear();
+    m_baseline.clear();
+}
+
+runtime::cpu::OpCounterShard* runtime::cpu::OpCounters::add_shard()
+{
+    lock_guard<mutex> lock(m_mutex);
+    m_shards.emplace_back(new OpCounterShard(m_ops.size()));
+    return m_shards.back().get();
+}
+
+vector<runtime::cpu::OpStats> runtime::cpu::OpCounters::merge_locked() const
+{
+    vector<OpStats> stats(m_ops.size());
+    for (size_t i = 0; i < m_ops.size(); ++i)
+    {
+        stats[i].m_node = m_ops[i];
+        for (auto& shard : m_shards)
+        {
+            shard->accumulate(i, stats[i]);
+        }
+    }
+    return stats;
+}
+
+vector<runtime::cpu::OpStats> runtime::cpu::OpCounters::get_stats() const
+{
+    lock_guard<mutex> lock(m_mutex);
+    vector<OpStats> stats = merge_locked();
+    if (!m_baseline.empty())
+    {
+        for (size_t i = 0; i < stats.size(); ++i)
+        {
+            stats[i].m_call_count -= m_baseline[i].m_call_count;
+            stats[i].m_total_nanoseconds -= m_baseline[i].m_total_nanoseconds;
+            for (size_t b = 0; b < OpLatencyHistogram::bucket_count; ++b)
+            {
+                stats[i].m_latency.m_counts[b] -= m_baseline[i].m_latency.m_counts[b];
+            }
+        }
+    }
+    return stats;
+}
+
+void runtime::cpu::OpCounters::reset()
+{
+    lock_guard<mutex> lock(m_mutex);
+    m_baseline = merge_locked();
+}
@@ -0,0 +1,136 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "cpu_backend_visibility.h"
+#include "ngraph/node.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            /// \brief Distribution of the latencies of an op. Every power of two nanoseconds is
+            ///        split into four buckets, so a percentile is reported within an eighth of
+            ///        the latency it stands for. Latencies above 8 seconds share the last
+            ///        bucket.
+            class CPU_BACKEND_API OpLatencyHistogram
+            {
+            public:
+                static constexpr size_t bucket_count = 128;
+
+                /// \brief The bucket counting a latency of nanoseconds
+                static size_t get_bucket(uint64_t nanoseconds);
+                /// \brief The smallest latency counted by bucket
+                static uint64_t get_lower_bound(size_t bucket);
+
+                /// \brief The latency in nanoseconds that a fraction p of the counted latencies
+                ///        do not exceed, or 0 when nothing was counted
+                uint64_t get_percentile(double p) const;
+                uint64_t get_count() const;
+
+                std::array<uint64_t, bucket_count> m_counts{};
+            };
+
+            /// \brief Counters of one op, merged over all runtime contexts
+            struct CPU_BACKEND_API OpStats
+            {
+                std::shared_ptr<const Node> m_node;
+                /// Calls of the function, including the ones that skipped the op because its
+                /// inputs had not changed
+                uint64_t m_call_count = 0;
+                uint64_t m_total_nanoseconds = 0;
+                /// Latencies of the calls that ran the op
+                OpLatencyHistogram m_latency;
+            };
+
+            /// \brief Counters of every op of a function for one runtime context.
+            ///
+            /// Only the thread running the context writes them, so updates are plain loads and
+            /// stores with no read-modify-write; the atomics only let get_stats() read them
+            /// from another thread while the context runs.
+            class OpCounterShard
+            {
+            public:
+                explicit OpCounterShard(size_t op_count);
+
+                void record(size_t index, uint64_t nanoseconds)
+                {
+                    Counters& c = m_counters[index];
+                    bump(c.m_call_count, 1);
+                    bump(c.m_total_nanoseconds, nanoseconds);
+                    bump(c.m_buckets[OpLatencyHistogram::get_bucket(nanoseconds)], 1);
+                }
+                void record_skipped(size_t index) { bump(m_counters[index].m_call_count, 1); }
+                /// \brief Adds the counters of op index to stats
+                void accumulate(size_t index, OpStats& stats) const;
+
+            private:
+                struct Counters
+                {
+                    std::atomic<uint64_t> m_call_count{0};
+                    std::atomic<uint64_t> m_total_nanoseconds{0};
+                    std::array<std::atomic<uint64_t>, OpLatencyHistogram::bucket_count>
+                        m_buckets{};
+                };
+
+                static void bump(std::atomic<uint64_t>& counter, uint64_t value)
+                {
+                    counter.store(counter.load(std::memory_order_relaxed) + value,
+                                  std::memory_order_relaxed);
+                }
+
+                std::unique_ptr<Counters[]> m_counters;
+            };
+
+            /// \brief The counter shards of every runtime context of a function, and the
+            ///        merged view of them
+            class OpCounters
+            {
+            public:
+                /// \brief Sets the ops the counters are indexed by, in execution order. Drops
+                ///        the shards added before.
+                void set_ops(std::vector<std::shared_ptr<const Node>> ops);
+                /// \brief A shard for a new runtime context. It lives as long as this object.
+                OpCounterShard* add_shard();
+                /// \brief Counters of every op since the last reset
+                std::vector<OpStats> get_stats() const;
+                /// \brief Starts the counters over from zero. Calls running at the same time
+                ///        count towards either side of the reset.
+                void reset();
+
+            private:
+                std::vector<OpStats> merge_locked() const;
+
+                mutable std::mutex m_mutex;
+                std::vector<std::shared_ptr<const Node>> m_ops;
+                std::vector<std::unique_ptr<OpCounterShard>> m_shards;
+                // counts at the last reset, subtracted from the running ones
+                std::vector<OpStats> m_baseline;
+            };
+        }
+    }
+}
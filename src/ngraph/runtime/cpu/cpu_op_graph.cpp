@@ -0,0 +1,185 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <limits>
+
+#include "ngraph/check.hpp"
+#include "ngraph/runtime/cpu/cpu_op_graph.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+runtime::cpu::OpGraph::OpGraph(const vector<vector<size_t>>& predecessors,
+                               const vector<uint64_t>& costs)
+    : m_successor_offsets(predecessors.size() + 1, 0)
+    , m_predecessor_counts(predecessors.size(), 0)
+    , m_priorities(new atomic<uint64_t>[predecessors.size()])
+{
+    NGRAPH_CHECK(costs.size() == predecessors.size(),
+                 "Expected a cost for each of the ",
+                 predecessors.size(),
+                 " functors, got ",
+                 costs.size());
+    for (size_t i = 0; i < predecessors.size(); i++)
+    {
+        m_predecessor_counts[i] = predecessors[i].size();
+        if (predecessors[i].empty())
+        {
+            m_sources.push_back(i);
+        }
+        for (size_t predecessor : predecessors[i])
+        {
+            NGRAPH_CHECK(predecessor < i,
+                         "Functor ",
+                         i,
+                         " waits for functor ",
+                         predecessor,
+                         ", which does not run before it");
+            m_successor_offsets[predecessor + 1]++;
+        }
+    }
+    for (size_t i = 0; i < predecessors.size(); i++)
+    {
+        m_successor_offsets[i + 1] += m_successor_offsets[i];
+    }
+    m_successors.resize(m_successor_offsets.back());
+    vector<size_t> fill(m_successor_offsets.begin(), m_successor_offsets.end() - 1);
+    for (size_t i = 0; i < predecessors.size(); i++)
+    {
+        for (size_t predecessor : predecessors[i])
+        {
+            m_successors[fill[predecessor]++] = i;
+        }
+    }
+    update_priorities(costs);
+}
+
+void runtime::cpu::OpGraph::update_priorities(const vector<uint64_t>& costs)
+{
+    NGRAPH_CHECK(costs.size() == size(),
+                 "Expected a cost for each of the ",
+                 size(),
+                 " functors, got ",
+                 costs.size());
+    // Every successor comes after its predecessors, so it is done before them
+    vector<uint64_t> priorities(costs.size());
+    for (size_t i = costs.size(); i-- > 0;)
+    {
+        uint64_t longest = 0;
+        for (size_t j = m_successor_offsets[i]; j < m_successor_offsets[i + 1]; j++)
+        {
+            longest = max(longest, priorities[m_successors[j]]);
+        }
+        priorities[i] = costs[i] + longest;
+        m_priorities[i].store(priorities[i], memory_order_relaxed);
+    }
+}
+
+vector<uint64_t> runtime::cpu::OpGraph::get_priorities() const
+{
+    vector<uint64_t> priorities;
+    for (size_t i = 0; i < size(); i++)
+    {
+        priorities.push_back(m_priorities[i].load(memory_order_relaxed));
+    }
+    return priorities;
+}
+
+#if defined(NGRAPH_TBB_ENABLE)
+struct runtime::cpu::OpGraph::Call
+{
+    Call(atomic<size_t>* pending, const function<void(size_t, int)>& execute)
+        : pending(pending)
+        , execute(execute)
+    {
+    }
+
+    atomic<size_t>* pending;
+    const function<void(size_t, int)>& execute;
+    tbb::task_group tasks;
+    // arena for the next chain of functors started
+    atomic<int> next_arena{1};
+};
+
+void runtime::cpu::OpGraph::run(atomic<size_t>* pending,
+                                const function<void(size_t, int)>& execute) const
+{
+    Call call(pending, execute);
+    for (size_t i = 0; i < size(); i++)
+    {
+        pending[i].store(m_predecessor_counts[i], memory_order_relaxed);
+    }
+
+    // The source on the longest path runs on this thread in the first arena, the others are
+    // started in order of priority on arenas of their own
+    vector<size_t> sources(m_sources);
+    sort(sources.begin(), sources.end(), [this](size_t a, size_t b) {
+        return m_priorities[a].load(memory_order_relaxed) >
+               m_priorities[b].load(memory_order_relaxed);
+    });
+    for (size_t i = 1; i < sources.size(); i++)
+    {
+        size_t source = sources[i];
+        int arena = call.next_arena.fetch_add(1, memory_order_relaxed);
+        call.tasks.run([this, &call, source, arena]() { run_from(call, source, arena); });
+    }
+    if (!sources.empty())
+    {
+        call.tasks.run_and_wait([this, &call, &sources]() { run_from(call, sources[0], 0); });
+    }
+}
+
+void runtime::cpu::OpGraph::run_from(Call& call, size_t index, int arena) const
+{
+    auto start = [this, &call](size_t op) {
+        int op_arena = call.next_arena.fetch_add(1, memory_order_relaxed);
+        call.tasks.run([this, &call, op, op_arena]() { run_from(call, op, op_arena); });
+    };
+
+    const size_t none = numeric_limits<size_t>::max();
+    while (index != none)
+    {
+        call.execute(index, arena);
+
+        // Stay on the critical path: continue with the ready successor of highest priority
+        size_t next = none;
+        uint64_t next_priority = 0;
+        for (size_t i = m_successor_offsets[index]; i < m_successor_offsets[index + 1]; i++)
+        {
+            size_t successor = m_successors[i];
+            if (call.pending[successor].fetch_sub(1, memory_order_acq_rel) == 1)
+            {
+                uint64_t priority = m_priorities[successor].load(memory_order_relaxed);
+                if (next == none || priority > next_priority)
+                {
+                    if (next != none)
+                    {
+                        start(next);
+                    }
+                    next = successor;
+                    next_priority = priority;
+                }
+                else
+                {
+                    start(successor);
+                }
+            }
+        }
+        index = next;
+    }
+}
+#endif
@@ -0,0 +1,94 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#if defined(NGRAPH_TBB_ENABLE)
+#include <tbb/task_group.h>
+#endif
+
+#include "cpu_backend_visibility.h"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            /// \brief Dependencies between the functors of an executable, which the inter-op
+            ///        scheduler runs each functor after.
+            ///
+            /// Built once per executable. Each call only resets one counter per functor, of the
+            /// predecessors it still waits for, and the last predecessor to finish runs it.
+            class CPU_BACKEND_API OpGraph
+            {
+            public:
+                /// \param predecessors predecessors[i] are the functors functor i waits for,
+                ///        each listed once and all of them before i
+                /// \param costs Estimated cost of each functor, see update_priorities()
+                OpGraph(const std::vector<std::vector<size_t>>& predecessors,
+                        const std::vector<uint64_t>& costs);
+
+                size_t size() const { return m_predecessor_counts.size(); }
+                /// \brief Sets the priority of every functor to the cost of the longest path
+                ///        from it to the end of the function
+                void update_priorities(const std::vector<uint64_t>& costs);
+                std::vector<uint64_t> get_priorities() const;
+
+#if defined(NGRAPH_TBB_ENABLE)
+                /// \brief Calls execute(index, arena) once for every functor, after it did for
+                ///        all of the functor's predecessors, and returns when all are done.
+                ///
+                /// Each chain of functors gets an arena number of its own, starting from 0 for
+                /// the one started on the calling thread.
+                /// \param pending size() counters owned by the call, which may not be shared
+                ///        with a call running at the same time
+                void run(std::atomic<size_t>* pending,
+                         const std::function<void(size_t, int)>& execute) const;
+#endif
+
+            private:
+#if defined(NGRAPH_TBB_ENABLE)
+                struct Call;
+                /// \brief Runs functor index, then whichever of its successors it was the last
+                ///        to wait for. The one with the highest priority continues on this
+                ///        thread and the others are handed to the tasks of the call.
+                void run_from(Call& call, size_t index, int arena) const;
+#endif
+
+                // Functors that wait for functor i are m_successors[m_successor_offsets[i]] up to
+                // m_successors[m_successor_offsets[i + 1]]
+                std::vector<size_t> m_successor_offsets;
+                std::vector<size_t> m_successors;
+                // number of functors each functor waits for
+                std::vector<size_t> m_predecessor_counts;
+                // functors that wait for none
+                std::vector<size_t> m_sources;
+                // Longest path cost from each functor to the end of the function. Calls running
+                // while it is updated may see a mix of old and new priorities, which only
+                // affects the order they pick ready functors in.
+                std::unique_ptr<std::atomic<uint64_t>[]> m_priorities;
+            };
+        }
+    }
+}
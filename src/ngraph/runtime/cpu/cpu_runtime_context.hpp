@@ -22,8 +22,7 @@
 
 #if defined(NGRAPH_TBB_ENABLE)
 #define TBB_PREVIEW_GLOBAL_CONTROL 1
-#define TBB_PREVIEW_FLOW_GRAPH_TRACE 1
-#include <tbb/flow_graph.h>
+#include <atomic>
 #include <tbb/global_control.h>
 #endif
 
@@ -61,12 +60,19 @@ namespace ngraph
             typedef std::chrono::time_point<Clock> Timestamp;
             typedef std::chrono::microseconds Timescale;
 
+            class OpCounterShard;
+
             extern "C" {
             struct CPURuntimeContext
             {
                 int64_t* op_durations;
+                // counters of the ops run by this context, written without synchronization
+                OpCounterShard* op_counters;
                 bool* p_en;
                 bool first_iteration;
+                // set when the intermediate buffers were last written by another context, so
+                // every op has to run again regardless of staleness
+                bool buffers_rebound;
                 // stores tensor pointers
                 std::vector<void*> buffer_data;
                 std::vector<dnnl::memory*> dnnl_memories;
@@ -76,7 +82,8 @@ namespace ngraph
                 AlignedBuffer* scratchpad_buffer;
                 std::vector<char*> dnnl_workspaces;
 #if defined(NGRAPH_TBB_ENABLE)
-                tbb::flow::graph* G;
+                // predecessors each functor still waits for in the running call
+                std::atomic<size_t>* op_pending;
                 tbb::global_control* c;
 #endif
                 State* const* states;
@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <string>
 
 #include "ngraph/runtime/cpu/cpu_backend_visibility.h"
@@ -58,6 +59,13 @@ namespace ngraph
                 /// \param source The source tensor
                 void copy_from(const ngraph::runtime::Tensor& source) override;
 
+                /// \brief Record reader as the last runtime context that took this tensor as an
+                ///        input, and return the one that took it before
+                const void* exchange_last_reader(const void* reader)
+                {
+                    return m_last_reader.exchange(reader);
+                }
+
                 static constexpr int BufferAlignment = NGRAPH_CPU_ALIGNMENT;
 
             private:
@@ -68,6 +76,7 @@ namespace ngraph
                 char* buffer;
                 char* aligned_buffer;
                 size_t buffer_size;
+                std::atomic<const void*> m_last_reader{nullptr};
             };
         }
     }
@@ -153,6 +153,18 @@ size_t DNNLEmitter::get_max_scratchpad_size() const
     return m_max_scratchpad_size;
 }
 
+size_t DNNLEmitter::get_workspace_size(const char* buf) const
+{
+    for (auto& workspace : m_workspaces)
+    {
+        if (workspace->buf == buf)
+        {
+            return workspace->size;
+        }
+    }
+    return 0;
+}
+
 dnnl::memory::desc DNNLEmitter::build_blocked_memory_descriptor(const dnnl::memory::dims& dim,
                                                                 const dnnl::memory::dims& strides,
                                                                 dnnl::memory::data_type dtype) const
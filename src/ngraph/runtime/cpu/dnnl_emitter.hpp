@@ -116,9 +116,14 @@ namespace ngraph
             class DNNLWorkspace
             {
             public:
-                DNNLWorkspace(size_t size) { buf = reinterpret_cast<char*>(ngraph_malloc(size)); }
+                DNNLWorkspace(size_t size)
+                    : size(size)
+                {
+                    buf = reinterpret_cast<char*>(ngraph_malloc(size));
+                }
                 ~DNNLWorkspace() { ngraph_free(buf); }
                 char* buf;
+                size_t size;
 
                 DNNLWorkspace(const DNNLWorkspace&) = delete;
                 DNNLWorkspace(DNNLWorkspace&&) = delete;
@@ -155,6 +160,8 @@ namespace ngraph
                 size_t get_dnnl_descriptors_size();
                 std::vector<size_t>& get_primitive_deps(size_t index);
                 size_t get_max_scratchpad_size() const;
+                /// \brief Size of the workspace whose buffer is buf, 0 if there is none
+                size_t get_workspace_size(const char* buf) const;
 
                 size_t build_quantized_inner_product_forward(
                     const dnnl::memory::desc& input_data_desc,
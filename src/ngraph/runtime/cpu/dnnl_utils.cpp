@@ -14,6 +14,7 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <sstream>
 #include <string>
 #include <typeindex>
 #include <typeinfo>
@@ -1197,6 +1198,29 @@ bool runtime::cpu::dnnl_utils::is_dnnl_desc_blocked_data_format(const dnnl::memo
     return blk.inner_nblks != 0;
 }
 
+string runtime::cpu::dnnl_utils::get_build_signature()
+{
+    const dnnl_version_t* version = dnnl_version();
+    stringstream signature;
+    signature << "ngraph " << NGRAPH_VERSION << ", dnnl " << version->major << "."
+              << version->minor << "." << version->patch << " " << version->hash << ", isa "
+              << static_cast<int>(dnnl_get_effective_cpu_isa());
+    return signature.str();
+}
+
+size_t runtime::cpu::dnnl_utils::get_memory_consumption(const dnnl::primitive& primitive)
+{
+    const_dnnl_primitive_desc_t pd = nullptr;
+    int64_t bytes = 0;
+    if (dnnl_primitive_get_primitive_desc(primitive.get(), &pd) != dnnl_success ||
+        dnnl_primitive_desc_query(pd, dnnl_query_memory_consumption_s64, 0, &bytes) !=
+            dnnl_success)
+    {
+        return 0;
+    }
+    return bytes > 0 ? static_cast<size_t>(bytes) : 0;
+}
+
 bool runtime::cpu::dnnl_utils::is_bf16_supported()
 {
     try
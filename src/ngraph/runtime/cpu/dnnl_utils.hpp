@@ -116,6 +116,13 @@ namespace ngraph
                 bool can_use_dnnl_batchnorm_bprop(const ngraph::Node* node);
 
                 bool CPU_BACKEND_API is_bf16_supported();
+                /// \brief The nGraph version, the full DNNL version and the instruction set
+                ///        DNNL dispatches to. An executable saved under one signature can
+                ///        only be loaded under the same one.
+                std::string CPU_BACKEND_API get_build_signature();
+                /// \brief Bytes DNNL holds for a primitive besides its inputs, outputs and
+                ///        scratchpad, as reported by the memory_consumption query
+                size_t get_memory_consumption(const dnnl::primitive& primitive);
 
                 //
                 // Intel(R) MKL-DNN supports the Winograd algorithm for convolutions with the
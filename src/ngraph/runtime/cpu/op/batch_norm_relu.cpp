@@ -14,6 +14,7 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include "ngraph/attribute_visitor.hpp"
 #include "ngraph/runtime/cpu/op/batch_norm_relu.hpp"
 #include "ngraph/op/constant.hpp"
 
@@ -21,6 +22,12 @@ using namespace ngraph;
 
 constexpr NodeTypeInfo op::BatchNormTrainingRelu::type_info;
 
+bool op::BatchNormTrainingRelu::visit_attributes(AttributeVisitor& visitor)
+{
+    visitor.on_attribute("epsilon", m_epsilon);
+    return true;
+}
+
 ngraph::op::BatchNormTrainingRelu::BatchNormTrainingRelu(double eps,
                                                          const Output<Node>& gamma,
                                                          const Output<Node>& beta,
@@ -81,6 +88,12 @@ ngraph::op::BatchNormTrainingRelu::BatchNormTrainingRelu(double eps,
 
 constexpr NodeTypeInfo op::BatchNormInferenceRelu::type_info;
 
+bool op::BatchNormInferenceRelu::visit_attributes(AttributeVisitor& visitor)
+{
+    visitor.on_attribute("epsilon", m_epsilon);
+    return true;
+}
+
 ngraph::op::BatchNormInferenceRelu::BatchNormInferenceRelu(double eps,
                                                            const Output<ngraph::Node>& gamma,
                                                            const Output<ngraph::Node>& beta,
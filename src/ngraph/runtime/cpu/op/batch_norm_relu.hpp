@@ -33,6 +33,8 @@ namespace ngraph
             CPU_BACKEND_API
             static constexpr NodeTypeInfo type_info{"BatchNormTrainingRelu", 0};
             const NodeTypeInfo& get_type_info() const override { return type_info; }
+            BatchNormTrainingRelu() = default;
+            bool visit_attributes(AttributeVisitor& visitor) override;
             CPU_BACKEND_API BatchNormTrainingRelu(double eps,
                                                   const Output<Node>& gamma,
                                                   const Output<Node>& beta,
@@ -63,6 +65,8 @@ namespace ngraph
             CPU_BACKEND_API
             static constexpr NodeTypeInfo type_info{"BatchNormInferenceRelu", 0};
             const NodeTypeInfo& get_type_info() const override { return type_info; }
+            BatchNormInferenceRelu() = default;
+            bool visit_attributes(AttributeVisitor& visitor) override;
             BatchNormInferenceRelu(double eps,
                                    const Output<ngraph::Node>& gamma,
                                    const Output<ngraph::Node>& beta,
@@ -13,6 +13,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 //*****************************************************************************
+#include "ngraph/attribute_visitor.hpp"
 #include "ngraph/runtime/cpu/op/bounded_relu.hpp"
 #include "ngraph/util.hpp"
 
@@ -21,6 +22,12 @@ using namespace ngraph;
 
 constexpr NodeTypeInfo op::BoundedRelu::type_info;
 
+bool op::BoundedRelu::visit_attributes(AttributeVisitor& visitor)
+{
+    visitor.on_attribute("alpha", m_alpha);
+    return true;
+}
+
 op::BoundedRelu::BoundedRelu(const Output<Node>& arg, float alpha)
     : UnaryElementwiseArithmetic(arg)
     , m_alpha(alpha)
@@ -33,6 +33,8 @@ namespace ngraph
             CPU_BACKEND_API
             static constexpr NodeTypeInfo type_info{"BoundedRelu", 0};
             const NodeTypeInfo& get_type_info() const override { return type_info; }
+            BoundedRelu() = default;
+            bool visit_attributes(AttributeVisitor& visitor) override;
             /// \brief Constructs a BoundedRelu operation.
             ///
             /// \param arg Node input to the Relu.
@@ -18,6 +18,7 @@
 
 #include "conv_add.hpp"
 
+#include "ngraph/attribute_visitor.hpp"
 #include "ngraph/op/convolution.hpp"
 #include "ngraph/util.hpp"
 
@@ -40,6 +41,17 @@ void op::util::validate_conv_shapes(const Node* node,
 
 constexpr NodeTypeInfo op::ConvolutionAdd::type_info;
 
+bool op::ConvolutionAdd::visit_attributes(AttributeVisitor& visitor)
+{
+    visitor.on_attribute("window_movement_strides", m_window_movement_strides);
+    visitor.on_attribute("window_dilation_strides", m_window_dilation_strides);
+    visitor.on_attribute("padding_below", m_padding_below);
+    visitor.on_attribute("padding_above", m_padding_above);
+    visitor.on_attribute("data_dilation_strides", m_data_dilation_strides);
+    visitor.on_attribute("with_relu", m_with_relu);
+    return true;
+}
+
 op::ConvolutionAdd::ConvolutionAdd(const std::shared_ptr<op::v0::Convolution>& conv,
                                    const Output<Node>& sum_input,
                                    bool with_relu)
@@ -16,6 +16,7 @@
 
 #include <numeric>
 
+#include "ngraph/attribute_visitor.hpp"
 #include "ngraph/op/convolution.hpp"
 #include "ngraph/runtime/cpu/op/conv_relu.hpp"
 #include "ngraph/util.hpp"
@@ -25,6 +26,16 @@ using namespace ngraph;
 
 constexpr NodeTypeInfo op::ConvolutionRelu::type_info;
 
+bool op::ConvolutionRelu::visit_attributes(AttributeVisitor& visitor)
+{
+    visitor.on_attribute("window_movement_strides", m_window_movement_strides);
+    visitor.on_attribute("window_dilation_strides", m_window_dilation_strides);
+    visitor.on_attribute("padding_below", m_padding_below);
+    visitor.on_attribute("padding_above", m_padding_above);
+    visitor.on_attribute("data_dilation_strides", m_data_dilation_strides);
+    return true;
+}
+
 op::ConvolutionRelu::ConvolutionRelu(const std::shared_ptr<op::v0::Convolution>& conv)
     : Op({conv->input_value(0), conv->input_value(1)})
     , m_window_movement_strides(conv->get_window_movement_strides())
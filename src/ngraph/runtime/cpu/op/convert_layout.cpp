@@ -15,6 +15,7 @@
 //*****************************************************************************
 
 #include "ngraph/runtime/cpu/op/convert_layout.hpp"
+#include "ngraph/attribute_visitor.hpp"
 #include "ngraph/runtime/cpu/cpu_layout_descriptor.hpp"
 #include "ngraph/runtime/cpu/dnnl_utils.hpp"
 
@@ -23,6 +24,12 @@ using namespace ngraph;
 
 constexpr NodeTypeInfo runtime::cpu::op::ConvertLayout::type_info;
 
+bool runtime::cpu::op::ConvertLayout::visit_attributes(AttributeVisitor& visitor)
+{
+    // The output layout is not an attribute; it is saved with the tensor layouts
+    return true;
+}
+
 runtime::cpu::op::ConvertLayout::ConvertLayout(
     const Output<Node>& arg, const shared_ptr<runtime::cpu::LayoutDescriptor>& layout)
     : Op({arg})
@@ -55,6 +62,11 @@ void runtime::cpu::op::ConvertLayout::validate_and_infer_types()
         // throw ngraph_error("Layout conversion input tensor is missing layout information");
     }
 
+    if (!output_layout)
+    {
+        // Default constructed; the output type and layout are restored by the caller
+        return;
+    }
     set_output_type(0, output_layout->get_element_type(), output_layout->get_shape());
     get_output_tensor_ptr(0)->set_tensor_layout(output_layout);
 }
@@ -38,6 +38,10 @@ namespace ngraph
                     CPU_BACKEND_API
                     static constexpr NodeTypeInfo type_info{"ConvertLayout", 0};
                     const NodeTypeInfo& get_type_info() const override { return type_info; }
+                    /// \brief Constructs a conversion whose layout is attached to its output
+                    ///        tensor afterwards, e.g. when loading a saved executable.
+                    ConvertLayout() = default;
+                    bool visit_attributes(AttributeVisitor& visitor) override;
                     CPU_BACKEND_API ConvertLayout(
                         const Output<Node>& arg,
                         const std::shared_ptr<ngraph::runtime::cpu::LayoutDescriptor>& layout);
@@ -18,6 +18,7 @@
 
 #include "deconv.hpp"
 
+#include "ngraph/attribute_visitor.hpp"
 #include "ngraph/log.hpp"
 #include "ngraph/op/convolution.hpp"
 #include "ngraph/util.hpp"
@@ -28,6 +29,23 @@ using namespace ngraph;
 
 constexpr NodeTypeInfo op::DeconvolutionBias::type_info;
 
+bool op::DeconvolutionBias::visit_attributes(AttributeVisitor& visitor)
+{
+    visitor.on_attribute("data_batch_shape", m_data_batch_shape);
+    visitor.on_attribute("window_movement_strides_forward", m_window_movement_strides_forward);
+    visitor.on_attribute("window_dilation_strides_forward", m_window_dilation_strides_forward);
+    visitor.on_attribute("padding_below_forward", m_padding_below_forward);
+    visitor.on_attribute("padding_above_forward", m_padding_above_forward);
+    visitor.on_attribute("data_dilation_strides_forward", m_data_dilation_strides_forward);
+    visitor.on_attribute("window_movement_strides_backward", m_window_movement_strides_backward);
+    visitor.on_attribute("window_dilation_strides_backward", m_window_dilation_strides_backward);
+    visitor.on_attribute("padding_below_backward", m_padding_below_backward);
+    visitor.on_attribute("padding_above_backward", m_padding_above_backward);
+    visitor.on_attribute("data_dilation_strides_backward", m_data_dilation_strides_backward);
+    visitor.on_attribute("with_relu", m_with_relu);
+    return true;
+}
+
 op::DeconvolutionBias::DeconvolutionBias(const Shape& data_batch_shape,
                                          const Output<Node>& filters,
                                          const Output<Node>& output_delta,
@@ -31,6 +31,8 @@ namespace ngraph
             CPU_BACKEND_API
             static constexpr NodeTypeInfo type_info{"DeconvolutionBias", 0};
             const NodeTypeInfo& get_type_info() const override { return type_info; }
+            DeconvolutionBias() = default;
+            bool visit_attributes(AttributeVisitor& visitor) override;
             /// \brief Constructs a batched-convolution data batch-backprop operation.
             ///
             /// \param data_batch_shape The shape of the data batch from forward-prop.
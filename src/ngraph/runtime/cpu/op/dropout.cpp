@@ -14,6 +14,7 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include "ngraph/attribute_visitor.hpp"
 #include "ngraph/runtime/cpu/op/dropout.hpp"
 
 #include "ngraph/log.hpp"
@@ -25,6 +26,11 @@ using namespace ngraph;
 
 constexpr NodeTypeInfo op::Dropout::type_info;
 
+bool op::Dropout::visit_attributes(AttributeVisitor& visitor)
+{
+    return true;
+}
+
 op::Dropout::Dropout(const Output<Node>& input,
                      const Output<Node>& gm_const,
                      const Output<Node>& use_seed,
@@ -30,6 +30,8 @@ namespace ngraph
             CPU_BACKEND_API
             static constexpr NodeTypeInfo type_info{"Dropout", 0};
             const NodeTypeInfo& get_type_info() const override { return type_info; }
+            Dropout() = default;
+            bool visit_attributes(AttributeVisitor& visitor) override;
             Dropout(const Output<Node>& input,
                     const Output<Node>& gm_const,
                     const Output<Node>& use_seed,
@@ -33,6 +33,10 @@ namespace ngraph
             CPU_BACKEND_API
             static constexpr NodeTypeInfo type_info{"GeluBackprop", 0};
             const NodeTypeInfo& get_type_info() const override { return type_info; }
+            GeluBackprop()
+                : BinaryElementwiseArithmetic(AutoBroadcastSpec::NONE)
+            {
+            }
             /// \brief Constructs a GeluBackprop operation.
             ///
             /// \param arg Node that produces the gelu forward input tensor.
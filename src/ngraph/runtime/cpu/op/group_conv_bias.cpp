@@ -18,6 +18,7 @@
 
 #include "group_conv_bias.hpp"
 
+#include "ngraph/attribute_visitor.hpp"
 #include "ngraph/util.hpp"
 
 using namespace std;
@@ -96,6 +97,19 @@ Shape op::GroupConvolutionBias::get_weights_dimensions()
 
 constexpr NodeTypeInfo op::GroupConvolutionBias::type_info;
 
+bool op::GroupConvolutionBias::visit_attributes(AttributeVisitor& visitor)
+{
+    visitor.on_attribute("window_movement_strides", m_window_movement_strides);
+    visitor.on_attribute("window_dilation_strides", m_window_dilation_strides);
+    visitor.on_attribute("padding_below", m_padding_below);
+    visitor.on_attribute("padding_above", m_padding_above);
+    visitor.on_attribute("data_dilation_strides", m_data_dilation_strides);
+    visitor.on_attribute("with_relu", m_with_relu);
+    visitor.on_attribute("groups", m_groups);
+    visitor.on_attribute("alpha", m_alpha);
+    return true;
+}
+
 op::GroupConvolutionBias::GroupConvolutionBias(const shared_ptr<op::v0::GroupConvolution>& conv,
                                                const Output<Node>& bias,
                                                size_t groups,
@@ -13,6 +13,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 //*****************************************************************************
+#include "ngraph/attribute_visitor.hpp"
 #include "ngraph/runtime/cpu/op/leaky_relu.hpp"
 #include "ngraph/util.hpp"
 
@@ -21,6 +22,12 @@ using namespace ngraph;
 
 constexpr NodeTypeInfo op::CPULeakyRelu::type_info;
 
+bool op::CPULeakyRelu::visit_attributes(AttributeVisitor& visitor)
+{
+    visitor.on_attribute("alpha", m_alpha);
+    return true;
+}
+
 op::CPULeakyRelu::CPULeakyRelu(const Output<Node>& arg, float alpha)
     : UnaryElementwiseArithmetic(arg)
     , m_alpha(alpha)
@@ -34,6 +34,8 @@ namespace ngraph
             CPU_BACKEND_API
             static constexpr NodeTypeInfo type_info{"CPULeakyRelu", 0};
             const NodeTypeInfo& get_type_info() const override { return type_info; }
+            CPULeakyRelu() = default;
+            bool visit_attributes(AttributeVisitor& visitor) override;
             /// \brief Constructs a CPULeakyRelu operation.
             ///
             /// \param arg Node input to the Relu.
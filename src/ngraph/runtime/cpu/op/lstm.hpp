@@ -32,6 +32,8 @@ namespace ngraph
             CPU_BACKEND_API
             static constexpr NodeTypeInfo type_info{"Lstm", 0};
             const NodeTypeInfo& get_type_info() const override { return type_info; }
+            Lstm() = default;
+            bool visit_attributes(AttributeVisitor& visitor) override;
             // INPUTS:
             // [0] - {Xt} input tensor of layout TNC, Shape{sequence length*batch_size,
             //       feature_size}
@@ -15,6 +15,7 @@
 //*****************************************************************************
 
 #include "matmul_bias.hpp"
+#include "ngraph/attribute_visitor.hpp"
 #include "ngraph/log.hpp"
 #include "ngraph/util.hpp"
 
@@ -23,6 +24,16 @@ using namespace ngraph;
 
 constexpr NodeTypeInfo op::MatmulBias::type_info;
 
+bool op::MatmulBias::visit_attributes(AttributeVisitor& visitor)
+{
+    visitor.on_attribute("shape_w", m_shape_w);
+    visitor.on_attribute("shape_x", m_shape_x);
+    visitor.on_attribute("transpose_w", m_transpose_w);
+    visitor.on_attribute("transpose_x", m_transpose_x);
+    visitor.on_attribute("broadcast_axes", m_broadcast_axes);
+    return true;
+}
+
 shared_ptr<Node> op::MatmulBias::clone_with_new_inputs(const OutputVector& new_args) const
 {
     if (new_args.size() != 2 && new_args.size() != 3)
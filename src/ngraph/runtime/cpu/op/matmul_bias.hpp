@@ -30,6 +30,8 @@ namespace ngraph
             CPU_BACKEND_API
             static constexpr NodeTypeInfo type_info{"MatmulBias", 0};
             const NodeTypeInfo& get_type_info() const override { return type_info; }
+            MatmulBias() = default;
+            bool visit_attributes(AttributeVisitor& visitor) override;
             CPU_BACKEND_API MatmulBias(const Output<Node>& W,
                                        const Output<Node>& x,
                                        const Output<Node>& b,
@@ -14,6 +14,7 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include "ngraph/attribute_visitor.hpp"
 #include "ngraph/runtime/cpu/op/max_pool_with_indices.hpp"
 #include "ngraph/function.hpp"
 #include "ngraph/op/add.hpp"
@@ -26,6 +27,15 @@ using namespace ngraph;
 
 constexpr NodeTypeInfo op::MaxPoolWithIndices::type_info;
 
+bool op::MaxPoolWithIndices::visit_attributes(AttributeVisitor& visitor)
+{
+    visitor.on_attribute("window_shape", m_window_shape);
+    visitor.on_attribute("window_movement_strides", m_window_movement_strides);
+    visitor.on_attribute("padding_below", m_padding_below);
+    visitor.on_attribute("padding_above", m_padding_above);
+    return true;
+}
+
 op::MaxPoolWithIndices::MaxPoolWithIndices(const Output<Node>& arg,
                                            const Shape& window_shape,
                                            const Strides& window_movement_strides,
@@ -184,6 +194,15 @@ shared_ptr<Node> op::MaxPoolWithIndices::clone_with_new_inputs(const OutputVecto
 
 constexpr NodeTypeInfo op::MaxPoolWithIndicesBackprop::type_info;
 
+bool op::MaxPoolWithIndicesBackprop::visit_attributes(AttributeVisitor& visitor)
+{
+    visitor.on_attribute("window_shape", m_window_shape);
+    visitor.on_attribute("window_movement_strides", m_window_movement_strides);
+    visitor.on_attribute("padding_below", m_padding_below);
+    visitor.on_attribute("padding_above", m_padding_above);
+    return true;
+}
+
 op::MaxPoolWithIndicesBackprop::MaxPoolWithIndicesBackprop(const Output<Node>& arg_forward,
                                                            const Output<Node>& delta,
                                                            const Output<Node>& indices,
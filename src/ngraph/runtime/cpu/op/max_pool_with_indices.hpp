@@ -35,6 +35,8 @@ namespace ngraph
             CPU_BACKEND_API
             static constexpr NodeTypeInfo type_info{"MaxPoolWithIndices", 0};
             const NodeTypeInfo& get_type_info() const override { return type_info; }
+            MaxPoolWithIndices() = default;
+            bool visit_attributes(AttributeVisitor& visitor) override;
             CPU_BACKEND_API MaxPoolWithIndices(const Output<Node>& arg,
                                                const Shape& window_shape,
                                                const Strides& window_movement_strides,
@@ -71,6 +73,8 @@ namespace ngraph
         public:
             static constexpr NodeTypeInfo type_info{"MaxPoolWithIndicesBackprop", 0};
             const NodeTypeInfo& get_type_info() const override { return type_info; }
+            MaxPoolWithIndicesBackprop() = default;
+            bool visit_attributes(AttributeVisitor& visitor) override;
             CPU_BACKEND_API MaxPoolWithIndicesBackprop(const Output<Node>& arg_forward,
                                                        const Output<Node>& delta,
                                                        const Output<Node>& indices,
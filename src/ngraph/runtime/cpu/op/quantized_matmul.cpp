@@ -18,6 +18,7 @@
 #include <memory>
 #include <utility>
 
+#include "ngraph/attribute_visitor.hpp"
 #include "ngraph/shape.hpp"
 #include "quantized_matmul.hpp"
 
@@ -26,6 +27,12 @@ using namespace ngraph;
 
 constexpr NodeTypeInfo op::QuantizedMatmul::type_info;
 
+bool op::QuantizedMatmul::visit_attributes(AttributeVisitor& visitor)
+{
+    visitor.on_attribute("output_type", m_output_type);
+    return true;
+}
+
 op::QuantizedMatmul::QuantizedMatmul(const Output<Node>& data,
                                      const Output<Node>& weights,
                                      const Output<Node>& scale,
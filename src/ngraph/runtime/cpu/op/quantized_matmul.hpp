@@ -31,6 +31,8 @@ namespace ngraph
             CPU_BACKEND_API
             static constexpr NodeTypeInfo type_info{"QuantizedMatmul", 0};
             const NodeTypeInfo& get_type_info() const override { return type_info; }
+            QuantizedMatmul() = default;
+            bool visit_attributes(AttributeVisitor& visitor) override;
             QuantizedMatmul(const Output<Node>& data,
                             const Output<Node>& weights,
                             const Output<Node>& scale,
@@ -14,6 +14,7 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include "ngraph/attribute_visitor.hpp"
 #include "ngraph/runtime/cpu/op/rnn.hpp"
 #include "ngraph/log.hpp"
 #include "ngraph/util.hpp"
@@ -23,6 +24,26 @@ using namespace ngraph;
 
 constexpr NodeTypeInfo op::Rnn::type_info;
 
+bool op::Rnn::visit_attributes(AttributeVisitor& visitor)
+{
+    visitor.on_attribute("num_timesteps", m_num_timesteps);
+    visitor.on_attribute("num_gates_per_cell", m_num_gates_per_cell);
+    visitor.on_attribute("src_sequence_length", m_src_sequence_length);
+    visitor.on_attribute("batch_size", m_batch_size);
+    visitor.on_attribute("src_layer_feature_size", m_src_layer_feature_size);
+    visitor.on_attribute("src_iter_feature_size", m_src_iter_feature_size);
+    visitor.on_attribute("dst_layer_feature_size", m_dst_layer_feature_size);
+    visitor.on_attribute("dst_iter_feature_size", m_dst_iter_feature_size);
+    visitor.on_attribute("num_cell_states", m_num_cell_states);
+    visitor.on_attribute("direction", m_direction);
+    visitor.on_attribute("num_fused_layers", m_num_fused_layers);
+    // rnntype has no attribute adapter; visit it as an integer
+    int64_t rnn_type = static_cast<int64_t>(m_rnntype);
+    visitor.on_attribute("rnn_type", rnn_type);
+    m_rnntype = static_cast<ngraph::runtime::cpu::rnn_utils::rnntype>(rnn_type);
+    return true;
+}
+
 shared_ptr<Node> op::Rnn::clone_with_new_inputs(const OutputVector& new_args) const
 {
     if (new_args.size() != 6 && new_args.size() != 5)
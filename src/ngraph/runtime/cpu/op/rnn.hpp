@@ -58,6 +58,8 @@ namespace ngraph
             CPU_BACKEND_API
             static constexpr NodeTypeInfo type_info{"Rnn", 0};
             const NodeTypeInfo& get_type_info() const override { return type_info; }
+            Rnn() = default;
+            bool visit_attributes(AttributeVisitor& visitor) override;
             CPU_BACKEND_API Rnn(const Output<Node>& src_layer,
                                 const Output<Node>& src_iter,
                                 const Output<Node>& weights_layer,
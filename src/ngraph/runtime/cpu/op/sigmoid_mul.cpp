@@ -15,6 +15,7 @@
 //*****************************************************************************
 
 #include "sigmoid_mul.hpp"
+#include "ngraph/attribute_visitor.hpp"
 #include "ngraph/log.hpp"
 #include "ngraph/op/add.hpp"
 #include "ngraph/op/broadcast.hpp"
@@ -54,6 +55,18 @@ ngraph::op::SigmoidMultiply::FunctionType
 
 constexpr NodeTypeInfo op::SigmoidMultiply::type_info;
 
+bool op::SigmoidMultiply::visit_attributes(AttributeVisitor& visitor)
+{
+    // FunctionType has no attribute adapter; visit it as an integer
+    int64_t input_0_type = static_cast<int64_t>(m_input_type[0]);
+    int64_t input_1_type = static_cast<int64_t>(m_input_type[1]);
+    visitor.on_attribute("input_0_type", input_0_type);
+    visitor.on_attribute("input_1_type", input_1_type);
+    m_input_type[0] = static_cast<FunctionType>(input_0_type);
+    m_input_type[1] = static_cast<FunctionType>(input_1_type);
+    return true;
+}
+
 op::SigmoidMultiply::SigmoidMultiply(const Output<Node>& input_0,
                                      const Output<Node>& input_1,
                                      const FunctionType input_0_type,
@@ -110,6 +123,18 @@ void op::SigmoidMultiply::generate_adjoints(autodiff::Adjoints& adjoints,
 
 constexpr NodeTypeInfo op::SigmoidMultiplyBackprop::type_info;
 
+bool op::SigmoidMultiplyBackprop::visit_attributes(AttributeVisitor& visitor)
+{
+    // FunctionType has no attribute adapter; visit it as an integer
+    int64_t input_0_type = static_cast<int64_t>(m_input_type[0]);
+    int64_t input_1_type = static_cast<int64_t>(m_input_type[1]);
+    visitor.on_attribute("input_0_type", input_0_type);
+    visitor.on_attribute("input_1_type", input_1_type);
+    m_input_type[0] = static_cast<FunctionType>(input_0_type);
+    m_input_type[1] = static_cast<FunctionType>(input_1_type);
+    return true;
+}
+
 op::SigmoidMultiplyBackprop::SigmoidMultiplyBackprop(const Output<Node>& input_0,
                                                      const Output<Node>& input_1,
                                                      const Output<Node>& delta,
@@ -33,6 +33,8 @@ namespace ngraph
             CPU_BACKEND_API
             static constexpr NodeTypeInfo type_info{"SigmoidMultiply", 0};
             const NodeTypeInfo& get_type_info() const override { return type_info; }
+            SigmoidMultiply() = default;
+            bool visit_attributes(AttributeVisitor& visitor) override;
             /// Defines valid function types
             enum class FunctionType
             {
@@ -73,6 +75,8 @@ namespace ngraph
             CPU_BACKEND_API
             static constexpr NodeTypeInfo type_info{"SigmoidMultiplyBackprop", 0};
             const NodeTypeInfo& get_type_info() const override { return type_info; }
+            SigmoidMultiplyBackprop() = default;
+            bool visit_attributes(AttributeVisitor& visitor) override;
             typedef SigmoidMultiply::FunctionType FunctionType;
             /// \brief Constructs a SigmoidMultiplyBackprop operation.
             ///
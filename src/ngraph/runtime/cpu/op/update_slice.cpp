@@ -14,6 +14,7 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include "ngraph/attribute_visitor.hpp"
 #include "ngraph/runtime/cpu/op/update_slice.hpp"
 
 using namespace std;
@@ -21,6 +22,14 @@ using namespace ngraph;
 
 constexpr NodeTypeInfo op::UpdateSlice::type_info;
 
+bool op::UpdateSlice::visit_attributes(AttributeVisitor& visitor)
+{
+    visitor.on_attribute("lower_bounds", m_lower_bounds);
+    visitor.on_attribute("upper_bounds", m_upper_bounds);
+    visitor.on_attribute("strides", m_strides);
+    return true;
+}
+
 op::UpdateSlice::UpdateSlice(const Output<Node>& arg0,
                              const Output<Node>& arg1,
                              const Coordinate& lower_bounds,
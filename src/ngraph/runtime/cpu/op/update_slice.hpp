@@ -56,6 +56,8 @@ namespace ngraph
             CPU_BACKEND_API
             static constexpr NodeTypeInfo type_info{"UpdateSlice", 0};
             const NodeTypeInfo& get_type_info() const override { return type_info; }
+            UpdateSlice() = default;
+            bool visit_attributes(AttributeVisitor& visitor) override;
             /// \brief Constructs a tensor slice update operation.
             ///
             /// \param arg0 The tensor to overwrite into.
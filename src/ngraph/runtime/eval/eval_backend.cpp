@@ -29,12 +29,17 @@ using namespace ngraph;
 extern "C" EVAL_BACKEND_API void ngraph_register_eval_backend()
 {
     runtime::BackendManager::register_backend("EVAL", [](const std::string& config) {
-        return std::make_shared<runtime::eval::EVALBackend>();
+        return std::make_shared<runtime::eval::EVALBackend>(runtime::TaskScheduler::create(config));
     });
 }
 
 runtime::eval::EVALBackend::EVALBackend() {}
 
+runtime::eval::EVALBackend::EVALBackend(const shared_ptr<TaskScheduler>& scheduler)
+    : m_scheduler{scheduler}
+{
+}
+
 shared_ptr<runtime::Tensor> runtime::eval::EVALBackend::create_tensor()
 {
     return make_shared<runtime::HostTensor>();
@@ -57,5 +62,5 @@ shared_ptr<runtime::Executable>
     runtime::eval::EVALBackend::compile(shared_ptr<Function> function,
                                         bool enable_performance_collection)
 {
-    return make_shared<EVALExecutable>(function, enable_performance_collection);
+    return make_shared<EVALExecutable>(function, enable_performance_collection, m_scheduler);
 }
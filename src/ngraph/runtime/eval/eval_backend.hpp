@@ -24,6 +24,7 @@
 
 #include "ngraph/runtime/backend.hpp"
 #include "ngraph/runtime/reference/allreduce.hpp"
+#include "ngraph/runtime/task_scheduler.hpp"
 #include "ngraph/runtime/tensor.hpp"
 
 namespace ngraph
@@ -42,6 +43,8 @@ class ngraph::runtime::eval::EVALBackend : public Backend
 {
 public:
     EVALBackend();
+    /// \param scheduler If set, the executables run independent ops in parallel on it
+    EVALBackend(const std::shared_ptr<TaskScheduler>& scheduler);
     EVALBackend(const EVALBackend&) = delete;
     EVALBackend(EVALBackend&&) = delete;
     EVALBackend& operator=(const EVALBackend&) = delete;
@@ -55,4 +58,7 @@ public:
 
     std::shared_ptr<Executable> compile(std::shared_ptr<Function> function,
                                         bool enable_performance_data = false) override;
+
+private:
+    std::shared_ptr<TaskScheduler> m_scheduler;
 };
@@ -37,7 +37,9 @@ using namespace ngraph;
 using descriptor::layout::DenseTensorLayout;
 
 runtime::eval::EVALExecutable::EVALExecutable(const shared_ptr<Function>& function,
-                                              bool enable_performance_collection)
+                                              bool enable_performance_collection,
+                                              const shared_ptr<TaskScheduler>& scheduler)
+    : m_scheduler{scheduler}
 {
     m_function = clone_function(*function);
 
@@ -63,6 +65,26 @@ runtime::eval::EVALExecutable::EVALExecutable(const shared_ptr<Function>& functi
         m_nodes.push_back(node);
     }
     set_parameters_and_results(*m_function);
+
+    if (m_scheduler)
+    {
+        unordered_map<const Node*, size_t> node_index;
+        m_task_graph = TaskGraph(m_nodes.size());
+        for (size_t i = 0; i < m_nodes.size(); ++i)
+        {
+            const shared_ptr<Node>& node = m_nodes[i];
+            for (auto& input : node->inputs())
+            {
+                m_task_graph.add_dependency(
+                    i, node_index.at(input.get_source_output().get_node()));
+            }
+            for (auto& control_dependency : node->get_control_dependencies())
+            {
+                m_task_graph.add_dependency(i, node_index.at(control_dependency.get()));
+            }
+            node_index[node.get()] = i;
+        }
+    }
 }
 
 bool runtime::eval::EVALExecutable::call(const vector<shared_ptr<runtime::Tensor>>& outputs,
@@ -108,13 +130,26 @@ bool runtime::eval::EVALExecutable::call(const vector<shared_ptr<runtime::Tensor
         tensor_map.insert({tensor, func_outputs[output_count]});
     }
 
-    // for each ordered op in the graph
+    // create the intermediates up front so that ops only read the map
     for (auto& op : m_nodes)
     {
-        auto type_id = get_typeid(*op);
-        if (type_id == OP_TYPEID::Parameter_v0)
+        for (size_t i = 0; i < op->get_output_size(); ++i)
         {
-            continue;
+            descriptor::Tensor* tensor = &op->output(i).get_tensor();
+            if (tensor_map.find(tensor) == tensor_map.end())
+            {
+                const Shape& shape = op->get_output_shape(i);
+                const element::Type& type = op->get_output_element_type(i);
+                string name = op->output(i).get_tensor().get_name();
+                tensor_map.insert({tensor, make_shared<runtime::HostTensor>(type, shape, name)});
+            }
+        }
+    }
+
+    auto evaluate = [&tensor_map](const shared_ptr<Node>& op) {
+        if (get_typeid(*op) == OP_TYPEID::Parameter_v0)
+        {
+            return;
         }
 
         // get op inputs from map
@@ -125,26 +160,11 @@ bool runtime::eval::EVALExecutable::call(const vector<shared_ptr<runtime::Tensor
             op_inputs.push_back(tensor_map.at(tensor));
         }
 
-        // get op outputs from map or create
+        // get op outputs from map
         vector<shared_ptr<HostTensor>> op_outputs;
         for (size_t i = 0; i < op->get_output_size(); ++i)
         {
-            descriptor::Tensor* tensor = &op->output(i).get_tensor();
-            shared_ptr<HostTensor> host_tensor;
-            auto it = tensor_map.find(tensor);
-            if (it == tensor_map.end())
-            {
-                const Shape& shape = op->get_output_shape(i);
-                const element::Type& type = op->get_output_element_type(i);
-                string name = op->output(i).get_tensor().get_name();
-                host_tensor = make_shared<runtime::HostTensor>(type, shape, name);
-                tensor_map.insert({tensor, host_tensor});
-            }
-            else
-            {
-                host_tensor = it->second;
-            }
-            op_outputs.push_back(host_tensor);
+            op_outputs.push_back(tensor_map.at(&op->output(i).get_tensor()));
         }
 
         string name = op->description() + "_v" + to_string(op->get_type_info().version);
@@ -152,6 +172,19 @@ bool runtime::eval::EVALExecutable::call(const vector<shared_ptr<runtime::Tensor
         {
             throw unsupported_op("Unsupported op '" + name + "'");
         }
+    };
+
+    if (m_scheduler)
+    {
+        m_scheduler->run(m_task_graph, [&](size_t index) { evaluate(m_nodes[index]); });
+    }
+    else
+    {
+        // for each ordered op in the graph
+        for (auto& op : m_nodes)
+        {
+            evaluate(op);
+        }
     }
 
     return true;
@@ -31,6 +31,7 @@
 #include "ngraph/runtime/host_tensor.hpp"
 #include "ngraph/runtime/opt_kernel/broadcast.hpp"
 #include "ngraph/runtime/opt_kernel/reshape.hpp"
+#include "ngraph/runtime/task_scheduler.hpp"
 #include "ngraph/runtime/tensor.hpp"
 
 namespace ngraph
@@ -63,8 +64,10 @@ class ngraph::runtime::eval::EVALExecutable : public runtime::Executable
     friend class EVALBackend;
 
 public:
+    /// \param scheduler If set, independent ops of a call run in parallel on its threads
     EVALExecutable(const std::shared_ptr<Function>& function,
-                   bool enable_performance_collection = false);
+                   bool enable_performance_collection = false,
+                   const std::shared_ptr<TaskScheduler>& scheduler = nullptr);
 
     bool call(const std::vector<std::shared_ptr<Tensor>>& outputs,
               const std::vector<std::shared_ptr<Tensor>>& intputs) override;
@@ -72,5 +75,8 @@ public:
 private:
     std::shared_ptr<Function> m_function;
     NodeVector m_nodes;
+    std::shared_ptr<TaskScheduler> m_scheduler;
+    // Data and control dependencies between the entries of m_nodes
+    TaskGraph m_task_graph;
     static OP_TYPEID get_typeid(const Node& node);
 };
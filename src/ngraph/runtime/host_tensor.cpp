@@ -180,6 +180,14 @@ void runtime::HostTensor::read(void* target, size_t n) const
     }
 }
 
+void runtime::HostTensor::set_memory_pointer(void* memory_pointer)
+{
+    NGRAPH_CHECK(m_memory_pointer != nullptr && memory_pointer != nullptr,
+                 "Only a tensor made on memory it does not own can be moved to other memory");
+    m_memory_pointer = memory_pointer;
+    m_aligned_buffer_pool = memory_pointer;
+}
+
 bool runtime::HostTensor::get_is_allocated() const
 {
     return m_aligned_buffer_pool != nullptr;
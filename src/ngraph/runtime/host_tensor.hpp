@@ -96,6 +96,9 @@ public:
     void read(void* p, size_t n) const override;
 
     bool get_is_allocated() const;
+    /// \brief Point a tensor made on memory it does not own at other memory of the same size
+    /// \param memory_pointer The new memory
+    void set_memory_pointer(void* memory_pointer);
     /// \brief Set the element type. Must be compatible with the current element type.
     /// \param element_type The element type
     void set_element_type(const element::Type& element_type);
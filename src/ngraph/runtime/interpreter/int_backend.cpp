@@ -30,8 +30,9 @@ using namespace ngraph;
 
 extern "C" INTERPRETER_BACKEND_API void ngraph_register_interpreter_backend()
 {
-    runtime::BackendManager::register_backend("INTERPRETER", [](const std::string& /* config */) {
-        return std::make_shared<runtime::interpreter::INTBackend>();
+    runtime::BackendManager::register_backend("INTERPRETER", [](const std::string& config) {
+        return std::make_shared<runtime::interpreter::INTBackend>(
+            runtime::TaskScheduler::create(config));
     });
 }
 
@@ -42,6 +43,11 @@ runtime::interpreter::INTBackend::INTBackend(const vector<string>& unsupported_o
 {
 }
 
+runtime::interpreter::INTBackend::INTBackend(const shared_ptr<TaskScheduler>& scheduler)
+    : m_scheduler{scheduler}
+{
+}
+
 shared_ptr<runtime::Tensor> runtime::interpreter::INTBackend::create_tensor()
 {
     return make_shared<runtime::HostTensor>();
@@ -70,7 +76,7 @@ shared_ptr<runtime::Executable>
     runtime::interpreter::INTBackend::compile(shared_ptr<Function> function,
                                               bool enable_performance_collection)
 {
-    return make_shared<INTExecutable>(function, enable_performance_collection);
+    return make_shared<INTExecutable>(function, enable_performance_collection, m_scheduler);
 }
 
 bool runtime::interpreter::INTBackend::is_supported(const Node& node) const
@@ -101,7 +107,7 @@ std::shared_ptr<runtime::Executable> runtime::interpreter::INTBackend::load(istr
             {
                 vector<char> buffer = reader.read(info);
                 string model_string = string(buffer.data(), buffer.size());
-                exec = shared_ptr<INTExecutable>(new INTExecutable(model_string));
+                exec = shared_ptr<INTExecutable>(new INTExecutable(model_string, m_scheduler));
                 break;
             }
         }
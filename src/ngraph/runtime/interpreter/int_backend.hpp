@@ -25,6 +25,7 @@
 #include "ngraph/runtime/interpreter/int_backend_visibility.hpp"
 
 #include "ngraph/runtime/backend_manager.hpp"
+#include "ngraph/runtime/task_scheduler.hpp"
 #include "ngraph/runtime/tensor.hpp"
 
 namespace ngraph
@@ -45,6 +46,8 @@ class INTERPRETER_BACKEND_API ngraph::runtime::interpreter::INTBackend : public
 public:
     INTBackend();
     INTBackend(const std::vector<std::string>& unsupported_op_name_list);
+    /// \param scheduler If set, the executables run independent ops in parallel on it
+    INTBackend(const std::shared_ptr<TaskScheduler>& scheduler);
     INTBackend(const INTBackend&) = delete;
     INTBackend(INTBackend&&) = delete;
     INTBackend& operator=(const INTBackend&) = delete;
@@ -70,4 +73,5 @@ public:
 
 private:
     std::set<std::string> m_unsupported_op_name_list;
+    std::shared_ptr<TaskScheduler> m_scheduler;
 };
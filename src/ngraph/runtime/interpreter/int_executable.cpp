@@ -14,6 +14,11 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <array>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+
 #include "ngraph/runtime/interpreter/int_executable.hpp"
 #include "ngraph/chrome_trace.hpp"
 #include "ngraph/cpio.hpp"
@@ -28,6 +33,7 @@
 #include "ngraph/pass/like_replacement.hpp"
 #include "ngraph/pass/liveness.hpp"
 #include "ngraph/pass/manager.hpp"
+#include "ngraph/pass/memory_layout.hpp"
 #include "ngraph/runtime/backend_manager.hpp"
 #include "ngraph/serializer.hpp"
 #include "ngraph/util.hpp"
@@ -61,9 +67,11 @@ runtime::interpreter::OP_TYPEID runtime::interpreter::INTExecutable::get_typeid(
 }
 
 runtime::interpreter::INTExecutable::INTExecutable(const shared_ptr<Function>& function,
-                                                   bool enable_performance_collection)
+                                                   bool enable_performance_collection,
+                                                   const shared_ptr<TaskScheduler>& scheduler)
     : m_is_compiled{true}
     , m_performance_counters_enabled{enable_performance_collection}
+    , m_scheduler{scheduler}
 {
 #ifndef NGRAPH_JSON_DISABLE
     // To verify that the serializer and deserializer work correctly let's just run this
@@ -79,6 +87,7 @@ runtime::interpreter::INTExecutable::INTExecutable(const shared_ptr<Function>& f
         {
         case OP_TYPEID::Clamp_v0:
         case OP_TYPEID::MatMul_v0:
+        case OP_TYPEID::TensorIterator_v0:
         {
             retval = true;
             break;
@@ -102,148 +111,732 @@ runtime::interpreter::INTExecutable::INTExecutable(const shared_ptr<Function>& f
         m_nodes.push_back(node);
     }
     set_parameters_and_results(*m_function);
+    build_call_plan();
 }
 
-runtime::interpreter::INTExecutable::INTExecutable(const std::string& model_string)
+runtime::interpreter::INTExecutable::INTExecutable(const std::string& model_string,
+                                                   const shared_ptr<TaskScheduler>& scheduler)
     : m_is_compiled{true}
     , m_performance_counters_enabled{false}
+    , m_scheduler{scheduler}
 {
     m_function = deserialize(model_string);
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::Liveness>();
+    pass_manager.run_passes(m_function);
     for (auto node : m_function->get_ordered_ops())
     {
         m_nodes.push_back(node);
     }
     set_parameters_and_results(*m_function);
+    build_call_plan();
 }
 
-bool runtime::interpreter::INTExecutable::call(const vector<shared_ptr<runtime::Tensor>>& outputs,
-                                               const vector<shared_ptr<runtime::Tensor>>& inputs)
+element::Type runtime::interpreter::INTExecutable::get_dispatch_type(const Node& op)
 {
-    event::Duration d1("call", "Interpreter");
-
-    // convert inputs to HostTensor
-    vector<shared_ptr<HostTensor>> func_inputs;
-    for (auto tensor : inputs)
+    element::Type type;
+    if (is_type<op::v0::Convert>(&op) || is_type<op::v0::Quantize>(&op) ||
+        is_type<op::v0::Dequantize>(&op) || is_type<op::v0::ArgMin>(&op) ||
+        is_type<op::v0::ArgMax>(&op))
     {
-        auto host_tensor = static_pointer_cast<runtime::HostTensor>(tensor);
-        func_inputs.push_back(host_tensor);
+        type = op.get_input_element_type(0);
     }
-    if (m_nan_check_enabled)
+    else if (is_type<op::v1::Equal>(&op) || is_type<op::v1::Greater>(&op) ||
+             is_type<op::v1::GreaterEqual>(&op) || is_type<op::v1::Less>(&op) ||
+             is_type<op::v1::LessEqual>(&op) || is_type<op::v1::NotEqual>(&op))
     {
-        perform_nan_check(func_inputs);
+        // Get the type of the second input, not the first
+        // All BinaryElementwiseComparision ops have the same type for inputs
+        // Select has bool for first input and the type we are interested in for the second
+        type = op.get_input_element_type(1);
+    }
+    else if (is_type<op::v0::TopK>(&op))
+    {
+        type = op.get_output_element_type(1);
     }
+    else
+    {
+        type = op.get_output_element_type(0);
+    }
+    return type;
+}
 
-    // convert outputs to HostTensor
-    vector<shared_ptr<HostTensor>> func_outputs;
-    for (auto tensor : outputs)
+void runtime::interpreter::INTExecutable::build_call_plan()
+{
+    // The pool can only be laid out when every intermediate has a known size
+    bool is_static = true;
+    for (auto& node : m_nodes)
+    {
+        for (auto& output : node->outputs())
+        {
+            if (output.get_partial_shape().is_dynamic() || output.get_element_type().is_dynamic())
+            {
+                is_static = false;
+            }
+        }
+    }
+    if (is_static)
     {
-        auto host_tensor = static_pointer_cast<runtime::HostTensor>(tensor);
-        func_outputs.push_back(host_tensor);
+        pass::Manager pass_manager;
+        pass_manager.register_pass<pass::MemoryLayout>(get_alignment(), false, true);
+        pass_manager.run_passes(m_function);
+        m_pool_size = m_function->get_temporary_pool_size();
     }
 
-    // map function params -> HostTensor
-    unordered_map<descriptor::Tensor*, shared_ptr<HostTensor>> tensor_map;
-    size_t input_count = 0;
-    for (auto param : get_parameters())
+    unordered_map<descriptor::Tensor*, size_t> slot_map;
+    // Byte range in the pool of each slot carved out of it
+    unordered_map<size_t, pair<size_t, size_t>> pool_ranges;
+    auto add_slot = [&](descriptor::Tensor* tensor) {
+        size_t slot = m_slot_count++;
+        slot_map.insert({tensor, slot});
+        return slot;
+    };
+
+    // Parameters and results are bound to the caller's tensors on each call
+    for (auto& param : get_parameters())
     {
         for (size_t i = 0; i < param->get_output_size(); ++i)
         {
-            descriptor::Tensor* tensor = &param->output(i).get_tensor();
-            tensor_map.insert({tensor, func_inputs[input_count++]});
+            m_parameter_slots.push_back(add_slot(&param->output(i).get_tensor()));
+        }
+    }
+    for (auto& result : get_results())
+    {
+        m_result_slots.push_back(add_slot(&result->get_output_tensor(0)));
+    }
+
+    for (auto& node : m_nodes)
+    {
+        if (node->is_parameter())
+        {
+            continue;
+        }
+        if (auto tensor_iterator = as_type_ptr<op::v0::TensorIterator>(node))
+        {
+            // The body runs on the thread of the TensorIterator, without a scheduler, since a
+            // worker waiting on tasks queued behind it could deadlock
+            auto body = tensor_iterator->get_body();
+            m_tensor_iterator_bodies[node.get()] = make_shared<INTExecutable>(
+                make_shared<Function>(body->get_results(), body->get_parameters()),
+                m_performance_counters_enabled);
+        }
+        NodeCall node_call;
+        node_call.m_node = node;
+        node_call.m_type = get_dispatch_type(*node);
+        for (auto& input : node->inputs())
+        {
+            node_call.m_input_slots.push_back(slot_map.at(&input.get_tensor()));
+        }
+        for (auto& output : node->outputs())
+        {
+            descriptor::Tensor* tensor = &output.get_tensor();
+            auto it = slot_map.find(tensor);
+            if (it != slot_map.end())
+            {
+                node_call.m_output_slots.push_back(it->second);
+                continue;
+            }
+            size_t slot = add_slot(tensor);
+            if (output.get_partial_shape().is_dynamic() || output.get_element_type().is_dynamic())
+            {
+                m_dynamic_slots.push_back({slot, output});
+            }
+            else if (is_static && node->liveness_new_list.count(tensor) != 0)
+            {
+                size_t offset = tensor->get_pool_offset();
+                m_static_slots.push_back({slot, output, offset});
+                pool_ranges[slot] = {offset, offset + tensor->size()};
+            }
+            else
+            {
+                // Constants are persistent and get storage of their own
+                m_static_slots.push_back({slot, output, string::npos});
+            }
+            node_call.m_output_slots.push_back(slot);
         }
+        m_node_calls.push_back(move(node_call));
     }
 
-    // map function outputs -> HostTensor
-    for (size_t output_count = 0; output_count < get_results().size(); ++output_count)
+    if (m_performance_counters_enabled)
     {
-        auto output = get_results()[output_count];
-        if (!is_type<op::v0::Result>(output))
+        // Create the timers up front so that parallel calls only look them up
+        for (NodeCall& node_call : m_node_calls)
         {
-            throw ngraph_error("One of function's outputs isn't op::v0::Result");
+            m_timer_map[node_call.m_node];
         }
-        descriptor::Tensor* tensor = &output->get_output_tensor(0);
-        tensor_map.insert({tensor, func_outputs[output_count]});
     }
 
-    // for each ordered op in the graph
-    for (auto op : m_nodes)
+    if (m_scheduler)
     {
-        event::Duration d2(op->description(), "Interpreter");
-        if (op->is_parameter())
+        unordered_map<size_t, size_t> slot_producers;
+        unordered_map<const Node*, size_t> node_call_index;
+        // The pool was laid out for the sequential order, in which a tensor only takes over
+        // memory once the tensors there before it are dead. A node call writing pool memory
+        // therefore also waits for the node calls that wrote or read the last tensors in it.
+        unordered_map<size_t, vector<size_t>> slot_users;
+        // Which slot last held each part of the pool, by the first byte of the part
+        map<size_t, pair<size_t, size_t>> pool_owners;
+        m_task_graph = TaskGraph(m_node_calls.size());
+        for (size_t i = 0; i < m_node_calls.size(); ++i)
         {
+            const NodeCall& node_call = m_node_calls[i];
+            for (size_t slot : node_call.m_input_slots)
+            {
+                auto producer = slot_producers.find(slot);
+                if (producer != slot_producers.end())
+                {
+                    m_task_graph.add_dependency(i, producer->second);
+                }
+            }
+            for (auto& control_dependency : node_call.m_node->get_control_dependencies())
+            {
+                auto producer = node_call_index.find(control_dependency.get());
+                if (producer != node_call_index.end())
+                {
+                    m_task_graph.add_dependency(i, producer->second);
+                }
+            }
+            for (size_t slot : node_call.m_output_slots)
+            {
+                slot_producers[slot] = i;
+                auto range = pool_ranges.find(slot);
+                if (range != pool_ranges.end())
+                {
+                    claim_pool_range(range->second.first,
+                                     range->second.second,
+                                     slot,
+                                     i,
+                                     pool_owners,
+                                     slot_users);
+                }
+            }
+            for (size_t slot : node_call.m_input_slots)
+            {
+                slot_users[slot].push_back(i);
+            }
+            for (size_t slot : node_call.m_output_slots)
+            {
+                slot_users[slot].push_back(i);
+            }
+            node_call_index[node_call.m_node.get()] = i;
+        }
+    }
+
+    // Have a context ready for the first call
+    m_free_contexts.push_back(create_call_context());
+}
+
+unique_ptr<runtime::interpreter::INTExecutable::CallContext>
+    runtime::interpreter::INTExecutable::create_call_context() const
+{
+    unique_ptr<CallContext> context(new CallContext);
+    context->m_tensor_slots.resize(m_slot_count);
+    for (const StaticSlot& static_slot : m_static_slots)
+    {
+        const Output<Node>& output = static_slot.m_output;
+        const element::Type& type = output.get_element_type();
+        const Shape& shape = output.get_shape();
+        const string& name = output.get_tensor().get_name();
+        shared_ptr<HostTensor> tensor;
+        if (static_slot.m_pool_offset != string::npos)
+        {
+            if (!context->m_memory_pool)
+            {
+                context->m_memory_pool.reset(new AlignedBuffer(m_pool_size, get_alignment()));
+            }
+            void* pool_ptr = context->m_memory_pool->get_ptr(static_slot.m_pool_offset);
+            tensor = make_shared<HostTensor>(type, shape, pool_ptr, name);
+        }
+        else
+        {
+            tensor = make_shared<HostTensor>(type, shape, name);
+        }
+        context->m_tensor_slots[static_slot.m_slot] = tensor;
+    }
+    context->m_inputs.resize(m_node_calls.size());
+    context->m_outputs.resize(m_node_calls.size());
+    for (size_t i = 0; i < m_node_calls.size(); ++i)
+    {
+        context->m_inputs[i].resize(m_node_calls[i].m_input_slots.size());
+        context->m_outputs[i].resize(m_node_calls[i].m_output_slots.size());
+    }
+    return context;
+}
+
+unique_ptr<runtime::interpreter::INTExecutable::CallContext>
+    runtime::interpreter::INTExecutable::acquire_call_context()
+{
+    {
+        lock_guard<mutex> lock(m_free_contexts_mutex);
+        if (!m_free_contexts.empty())
+        {
+            unique_ptr<CallContext> context = move(m_free_contexts.back());
+            m_free_contexts.pop_back();
+            return context;
+        }
+    }
+    return create_call_context();
+}
+
+void runtime::interpreter::INTExecutable::release_call_context(unique_ptr<CallContext> context)
+{
+    lock_guard<mutex> lock(m_free_contexts_mutex);
+    m_free_contexts.push_back(move(context));
+}
+
+void runtime::interpreter::INTExecutable::claim_pool_range(
+    size_t begin,
+    size_t end,
+    size_t slot,
+    size_t task,
+    map<size_t, pair<size_t, size_t>>& pool_owners,
+    unordered_map<size_t, vector<size_t>>& slot_users)
+{
+    auto it = pool_owners.upper_bound(begin);
+    if (it != pool_owners.begin())
+    {
+        --it;
+    }
+    while (it != pool_owners.end() && it->first < end)
+    {
+        size_t part_begin = it->first;
+        size_t part_end = it->second.first;
+        size_t owner = it->second.second;
+        if (part_end <= begin)
+        {
+            ++it;
             continue;
         }
+        for (size_t user : slot_users[owner])
+        {
+            if (user < task)
+            {
+                m_task_graph.add_dependency(task, user);
+            }
+        }
+        it = pool_owners.erase(it);
+        if (part_begin < begin)
+        {
+            pool_owners[part_begin] = {begin, owner};
+        }
+        if (part_end > end)
+        {
+            it = pool_owners.insert({end, {part_end, owner}}).first;
+        }
+    }
+    pool_owners[begin] = {end, slot};
+}
+
+void runtime::interpreter::INTExecutable::run_node_call(size_t index, CallContext& context)
+{
+    const NodeCall& node_call = m_node_calls[index];
+    const shared_ptr<Node>& op = node_call.m_node;
+    event::Duration d2(op->description(), "Interpreter");
+    vector<shared_ptr<HostTensor>>& inputs = context.m_inputs[index];
+    vector<shared_ptr<HostTensor>>& outputs = context.m_outputs[index];
+    for (size_t i = 0; i < node_call.m_input_slots.size(); ++i)
+    {
+        inputs[i] = context.m_tensor_slots[node_call.m_input_slots[i]];
+    }
+    for (size_t i = 0; i < node_call.m_output_slots.size(); ++i)
+    {
+        outputs[i] = context.m_tensor_slots[node_call.m_output_slots[i]];
+    }
+
+    if (m_performance_counters_enabled)
+    {
+        m_timer_map.at(op).start();
+    }
+    generate_calls(node_call.m_type, *op, outputs, inputs);
+    if (m_performance_counters_enabled)
+    {
+        m_timer_map.at(op).stop();
+    }
+    if (m_nan_check_enabled)
+    {
+        perform_nan_check(outputs, op.get());
+    }
+}
+
+namespace
+{
+    /// \brief A tensor cut into parts of equal size along one axis, the way TensorIterator
+    ///        slices its inputs and concatenates its outputs.
+    class AxisParts
+    {
+    public:
+        AxisParts(const HostTensor& tensor,
+                  int64_t start,
+                  int64_t stride,
+                  int64_t part_size,
+                  int64_t axis)
+            : m_stride(stride)
+            , m_part_size(part_size)
+        {
+            const Shape& shape = tensor.get_shape();
+            NGRAPH_CHECK(axis >= 0 && static_cast<size_t>(axis) < shape.size(),
+                         "TensorIterator axis ",
+                         axis,
+                         " is out of range for shape ",
+                         shape);
+            m_length = shape[axis];
+            m_start = start < 0 ? start + m_length : start;
+            m_outer = shape_size(Shape(shape.begin(), shape.begin() + axis));
+            m_inner_bytes = shape_size(Shape(shape.begin() + axis + 1, shape.end())) *
+                            tensor.get_element_type().size();
+        }
+
+        /// \brief Every part is a single run of memory
+        bool is_contiguous() const { return m_outer == 1; }
+        /// \brief Parts of different iterations never overlap
+        bool is_disjoint() const { return std::abs(m_stride) >= m_part_size; }
+        /// \brief Byte offset of the part of \p iteration within the first outer index
+        size_t get_offset(int64_t iteration) const
+        {
+            // A negative stride walks the axis backwards, with start the last index of the
+            // first part
+            int64_t first = m_stride < 0 ? m_start + iteration * m_stride - m_part_size + 1
+                                         : m_start + iteration * m_stride;
+            NGRAPH_CHECK(first >= 0 && first + m_part_size <= m_length,
+                         "TensorIterator part of iteration ",
+                         iteration,
+                         " is out of range");
+            return first * m_inner_bytes;
+        }
+        void gather(const HostTensor& tensor, HostTensor& part, int64_t iteration) const
+        {
+            const char* whole = static_cast<const char*>(tensor.get_data_ptr());
+            copy(whole + get_offset(iteration),
+                 m_length * m_inner_bytes,
+                 static_cast<char*>(part.get_data_ptr()),
+                 m_part_size * m_inner_bytes);
+        }
+        void scatter(const HostTensor& part, HostTensor& tensor, int64_t iteration) const
+        {
+            char* whole = static_cast<char*>(tensor.get_data_ptr());
+            copy(static_cast<const char*>(part.get_data_ptr()),
+                 m_part_size * m_inner_bytes,
+                 whole + get_offset(iteration),
+                 m_length * m_inner_bytes);
+        }
 
-        // get op inputs from map
-        vector<shared_ptr<HostTensor>> op_inputs;
-        for (auto input : op->inputs())
+    private:
+        void copy(const char* src, size_t src_stride, char* dst, size_t dst_stride) const
         {
-            descriptor::Tensor* tensor = &input.get_tensor();
-            op_inputs.push_back(tensor_map.at(tensor));
+            size_t part_bytes = m_part_size * m_inner_bytes;
+            for (size_t i = 0; i < m_outer; ++i)
+            {
+                memcpy(dst + i * dst_stride, src + i * src_stride, part_bytes);
+            }
         }
 
-        // get op outputs from map or create
-        vector<shared_ptr<HostTensor>> op_outputs;
-        for (size_t i = 0; i < op->get_output_size(); ++i)
+        int64_t m_start;
+        int64_t m_stride;
+        int64_t m_part_size;
+        int64_t m_length;
+        size_t m_outer;
+        size_t m_inner_bytes;
+    };
+}
+
+void runtime::interpreter::INTExecutable::run_tensor_iterator(
+    const op::v0::TensorIterator& tensor_iterator,
+    const vector<shared_ptr<HostTensor>>& out,
+    const vector<shared_ptr<HostTensor>>& args)
+{
+    using TensorIterator = op::v0::TensorIterator;
+    INTExecutable& body = *m_tensor_iterator_bodies.at(&tensor_iterator);
+    const ParameterVector& parameters = tensor_iterator.get_body()->get_parameters();
+    const ResultVector& results = tensor_iterator.get_body()->get_results();
+    int64_t num_iterations = tensor_iterator.get_num_iterations();
+    NGRAPH_CHECK(num_iterations >= 0,
+                 "TensorIterator ",
+                 tensor_iterator.get_name(),
+                 " has an unknown number of iterations");
+
+    // Sliced inputs are copied to a buffer only when their parts are not contiguous. Otherwise
+    // the body reads a view that is moved to the next part on every iteration.
+    struct SlicedInput
+    {
+        size_t m_parameter_index;
+        shared_ptr<HostTensor> m_input;
+        AxisParts m_parts;
+        shared_ptr<HostTensor> m_buffer;
+        shared_ptr<HostTensor> m_view;
+    };
+    struct MergedInput
+    {
+        size_t m_parameter_index;
+        size_t m_result_index;
+    };
+    vector<SlicedInput> sliced_inputs;
+    vector<MergedInput> merged_inputs;
+    vector<shared_ptr<runtime::Tensor>> body_inputs(parameters.size());
+    for (auto& description : tensor_iterator.get_input_descriptions())
+    {
+        size_t parameter_index = description->m_body_parameter_index;
+        const shared_ptr<HostTensor>& input = args.at(description->m_input_index);
+        if (auto slice = as_type_ptr<TensorIterator::SliceInputDescription>(description))
         {
-            descriptor::Tensor* tensor = &op->output(i).get_tensor();
-            shared_ptr<HostTensor> host_tensor;
-            auto it = tensor_map.find(tensor);
-            if (it == tensor_map.end())
+            AxisParts parts(
+                *input, slice->m_start, slice->m_stride, slice->m_part_size, slice->m_axis);
+            const auto& parameter = parameters.at(parameter_index);
+            shared_ptr<HostTensor> buffer;
+            shared_ptr<HostTensor> view;
+            if (parts.is_contiguous())
             {
-                const PartialShape& shape = op->get_output_partial_shape(i);
-                const element::Type& type = op->get_output_element_type(i);
-                string name = op->output(i).get_tensor().get_name();
-                host_tensor = make_shared<runtime::HostTensor>(type, shape, name);
-                tensor_map.insert({tensor, host_tensor});
+                view = make_shared<HostTensor>(parameter->get_output_element_type(0),
+                                               parameter->get_output_shape(0),
+                                               input->get_data_ptr());
+                body_inputs[parameter_index] = view;
             }
             else
             {
-                host_tensor = it->second;
+                buffer = make_shared<HostTensor>(parameter->get_output_element_type(0),
+                                                 parameter->get_output_shape(0));
+                body_inputs[parameter_index] = buffer;
             }
-            op_outputs.push_back(host_tensor);
+            sliced_inputs.push_back({parameter_index, input, parts, buffer, view});
+        }
+        else if (auto merged = as_type_ptr<TensorIterator::MergedInputDescription>(description))
+        {
+            // The initial value is read in place on the first iteration
+            body_inputs[parameter_index] = input;
+            merged_inputs.push_back({parameter_index, merged->m_body_value_index});
+        }
+        else
+        {
+            body_inputs[parameter_index] = input;
         }
+    }
 
-        // get op type
-        element::Type type;
-        if (is_type<op::v0::Convert>(op) || is_type<op::v0::Quantize>(op) ||
-            is_type<op::v0::Dequantize>(op) || is_type<op::v0::ArgMin>(op) ||
-            is_type<op::v0::ArgMax>(op))
+    struct ConcatOutput
+    {
+        size_t m_result_index;
+        shared_ptr<HostTensor> m_output;
+        AxisParts m_parts;
+    };
+    struct BodyOutput
+    {
+        size_t m_result_index;
+        shared_ptr<HostTensor> m_output;
+        int64_t m_iteration;
+    };
+    vector<ConcatOutput> concat_outputs;
+    vector<BodyOutput> body_outputs;
+    for (auto& description : tensor_iterator.get_output_descriptions())
+    {
+        size_t result_index = description->m_body_value_index;
+        const shared_ptr<HostTensor>& output = out.at(description->m_output_index);
+        if (auto concat = as_type_ptr<TensorIterator::ConcatOutputDescription>(description))
         {
-            type = op->get_input_element_type(0);
+            AxisParts parts(
+                *output, concat->m_start, concat->m_stride, concat->m_part_size, concat->m_axis);
+            concat_outputs.push_back({result_index, output, parts});
         }
-        else if (is_type<op::v1::Equal>(op) || is_type<op::v1::Greater>(op) ||
-                 is_type<op::v1::GreaterEqual>(op) || is_type<op::v1::Less>(op) ||
-                 is_type<op::v1::LessEqual>(op) || is_type<op::v1::NotEqual>(op))
+        else if (auto body_output =
+                     as_type_ptr<TensorIterator::BodyOutputDescription>(description))
         {
-            // Get the type of the second input, not the first
-            // All BinaryElementwiseComparision ops have the same type for inputs
-            // Select has bool for first input and the type we are interested in for the second
-            type = op->get_input_element_type(1);
+            int64_t iteration = body_output->m_iteration;
+            body_outputs.push_back(
+                {result_index, output, iteration < 0 ? num_iterations + iteration : iteration});
         }
-        else if (is_type<op::v0::TopK>(op))
+    }
+
+    // A result is written straight into the first concatenated output it can be a view of.
+    // Other results get a buffer, and a second one when they feed a merged input, so that the
+    // body never writes the tensor it is reading.
+    vector<size_t> result_views(results.size(), concat_outputs.size());
+    for (size_t i = 0; i < concat_outputs.size(); ++i)
+    {
+        const ConcatOutput& concat_output = concat_outputs[i];
+        size_t& view = result_views[concat_output.m_result_index];
+        if (view == concat_outputs.size() && concat_output.m_parts.is_contiguous() &&
+            concat_output.m_parts.is_disjoint())
         {
-            type = op->get_output_element_type(1);
+            view = i;
         }
-        else
+    }
+    vector<array<shared_ptr<HostTensor>, 2>> result_buffers(results.size());
+    for (size_t i = 0; i < results.size(); ++i)
+    {
+        if (result_views[i] == concat_outputs.size())
+        {
+            result_buffers[i][0] = make_shared<HostTensor>(results[i]->get_output_element_type(0),
+                                                           results[i]->get_output_shape(0));
+        }
+    }
+    for (const MergedInput& merged_input : merged_inputs)
+    {
+        auto& buffers = result_buffers[merged_input.m_result_index];
+        if (buffers[0] && !buffers[1])
         {
-            type = op->get_output_element_type(0);
+            buffers[1] = make_shared<HostTensor>(buffers[0]->get_element_type(),
+                                                 buffers[0]->get_shape());
         }
+    }
 
-        if (m_performance_counters_enabled)
+    // The views of the results in their concatenated outputs, made once and moved along. A
+    // merged input reads the view of the previous iteration, so there are two to alternate.
+    vector<array<shared_ptr<HostTensor>, 2>> result_view_tensors(results.size());
+    for (size_t i = 0; i < results.size(); ++i)
+    {
+        if (result_views[i] != concat_outputs.size())
         {
-            m_timer_map[op].start();
+            for (auto& view : result_view_tensors[i])
+            {
+                view = make_shared<HostTensor>(
+                    results[i]->get_output_element_type(0),
+                    results[i]->get_output_shape(0),
+                    concat_outputs[result_views[i]].m_output->get_data_ptr());
+            }
         }
-        generate_calls(type, *op.get(), op_outputs, op_inputs);
-        if (m_performance_counters_enabled)
+    }
+
+    vector<shared_ptr<HostTensor>> result_tensors(results.size());
+    vector<shared_ptr<runtime::Tensor>> body_results(results.size());
+    for (int64_t iteration = 0; iteration < num_iterations; ++iteration)
+    {
+        for (SlicedInput& sliced_input : sliced_inputs)
+        {
+            if (sliced_input.m_buffer)
+            {
+                sliced_input.m_parts.gather(
+                    *sliced_input.m_input, *sliced_input.m_buffer, iteration);
+            }
+            else
+            {
+                char* data = static_cast<char*>(sliced_input.m_input->get_data_ptr());
+                sliced_input.m_view->set_memory_pointer(
+                    data + sliced_input.m_parts.get_offset(iteration));
+            }
+        }
+        for (size_t i = 0; i < results.size(); ++i)
+        {
+            if (result_views[i] != concat_outputs.size())
+            {
+                const ConcatOutput& concat_output = concat_outputs[result_views[i]];
+                char* data = static_cast<char*>(concat_output.m_output->get_data_ptr());
+                const shared_ptr<HostTensor>& view = result_view_tensors[i][iteration % 2];
+                view->set_memory_pointer(data + concat_output.m_parts.get_offset(iteration));
+                result_tensors[i] = view;
+            }
+            else
+            {
+                auto& buffers = result_buffers[i];
+                result_tensors[i] = buffers[buffers[1] ? iteration % 2 : 0];
+            }
+            body_results[i] = result_tensors[i];
+        }
+
+        body.call(body_results, body_inputs);
+
+        for (size_t i = 0; i < concat_outputs.size(); ++i)
+        {
+            const ConcatOutput& concat_output = concat_outputs[i];
+            if (result_views[concat_output.m_result_index] != i)
+            {
+                concat_output.m_parts.scatter(*result_tensors[concat_output.m_result_index],
+                                              *concat_output.m_output,
+                                              iteration);
+            }
+        }
+        for (const BodyOutput& body_output : body_outputs)
+        {
+            if (body_output.m_iteration == iteration)
+            {
+                memcpy(body_output.m_output->get_data_ptr(),
+                       result_tensors[body_output.m_result_index]->get_data_ptr(),
+                       body_output.m_output->get_size_in_bytes());
+            }
+        }
+        for (const MergedInput& merged_input : merged_inputs)
+        {
+            body_inputs[merged_input.m_parameter_index] =
+                result_tensors[merged_input.m_result_index];
+        }
+    }
+}
+
+bool runtime::interpreter::INTExecutable::call(const vector<shared_ptr<runtime::Tensor>>& outputs,
+                                               const vector<shared_ptr<runtime::Tensor>>& inputs)
+{
+    event::Duration d1("call", "Interpreter");
+    unique_lock<mutex> timed_call_lock(m_timed_call_mutex, defer_lock);
+    if (m_performance_counters_enabled)
+    {
+        timed_call_lock.lock();
+    }
+    // A call that throws drops its context, a later call makes a new one
+    unique_ptr<CallContext> context = acquire_call_context();
+    vector<shared_ptr<HostTensor>>& tensor_slots = context->m_tensor_slots;
+
+    // bind function params and outputs to their slots
+    for (size_t i = 0; i < m_parameter_slots.size(); ++i)
+    {
+        tensor_slots[m_parameter_slots[i]] = static_pointer_cast<HostTensor>(inputs[i]);
+    }
+    if (m_nan_check_enabled)
+    {
+        vector<shared_ptr<HostTensor>> func_inputs;
+        for (size_t slot : m_parameter_slots)
+        {
+            func_inputs.push_back(tensor_slots[slot]);
+        }
+        perform_nan_check(func_inputs);
+    }
+    for (size_t i = 0; i < m_result_slots.size(); ++i)
+    {
+        tensor_slots[m_result_slots[i]] = static_pointer_cast<HostTensor>(outputs[i]);
+    }
+
+    // intermediates with a dynamic shape can not live in the pool
+    for (auto& dynamic_slot : m_dynamic_slots)
+    {
+        tensor_slots[dynamic_slot.first] = make_shared<HostTensor>(dynamic_slot.second);
+    }
+
+    if (m_scheduler)
+    {
+        CallContext& call_context = *context;
+        m_scheduler->run(m_task_graph, [this, &call_context](size_t index) {
+            run_node_call(index, call_context);
+        });
+    }
+    else
+    {
+        // for each ordered op in the graph
+        for (size_t i = 0; i < m_node_calls.size(); ++i)
+        {
+            run_node_call(i, *context);
+        }
+    }
+
+    // don't hold on to the caller's tensors
+    for (size_t slot : m_parameter_slots)
+    {
+        tensor_slots[slot].reset();
+    }
+    for (size_t slot : m_result_slots)
+    {
+        tensor_slots[slot].reset();
+    }
+    for (auto& dynamic_slot : m_dynamic_slots)
+    {
+        tensor_slots[dynamic_slot.first].reset();
+    }
+    for (size_t i = 0; i < m_node_calls.size(); ++i)
+    {
+        for (auto& tensor : context->m_inputs[i])
         {
-            m_timer_map[op].stop();
+            tensor.reset();
         }
-        if (m_nan_check_enabled)
+        for (auto& tensor : context->m_outputs[i])
         {
-            perform_nan_check(op_outputs, op.get());
+            tensor.reset();
         }
     }
+    release_call_context(move(context));
 
     return true;
 }
@@ -257,6 +850,8 @@ void runtime::interpreter::INTExecutable::generate_calls(const element::Type& ty
     switch (type)
     {
     case element::Type_t::boolean: op_engine<char>(op, out, in); break;
+    case element::Type_t::bf16: op_engine<bfloat16>(op, out, in); break;
+    case element::Type_t::f16: op_engine<float16>(op, out, in); break;
     case element::Type_t::f32: op_engine<float>(op, out, in); break;
     case element::Type_t::f64: op_engine<double>(op, out, in); break;
     case element::Type_t::i8: op_engine<int8_t>(op, out, in); break;
@@ -270,8 +865,6 @@ void runtime::interpreter::INTExecutable::generate_calls(const element::Type& ty
     case element::Type_t::undefined:
     case element::Type_t::dynamic:
     case element::Type_t::u1:
-    case element::Type_t::bf16:
-    case element::Type_t::f16:
         ss << "unsupported element type " << type << " op " << op.get_name();
         throw ngraph_error(ss.str());
     }
@@ -18,9 +18,12 @@
 
 #include <initializer_list>
 #include <iostream>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "ngraph/coordinate.hpp"
@@ -123,6 +126,7 @@
 #include "ngraph/runtime/reference/tanh.hpp"
 #include "ngraph/runtime/reference/topk.hpp"
 #include "ngraph/runtime/reference/xor.hpp"
+#include "ngraph/runtime/task_scheduler.hpp"
 #include "ngraph/runtime/tensor.hpp"
 #include "ngraph/slice_plan.hpp"
 #include "ngraph/state/bernoulli_rng_state.hpp"
@@ -159,8 +163,10 @@ class INTERPRETER_BACKEND_API ngraph::runtime::interpreter::INTExecutable : publ
     friend class INTBackend;
 
 public:
+    /// \param scheduler If set, independent ops of a call run in parallel on its threads
     INTExecutable(const std::shared_ptr<Function>& function,
-                  bool enable_performance_collection = false);
+                  bool enable_performance_collection = false,
+                  const std::shared_ptr<TaskScheduler>& scheduler = nullptr);
 
     bool call(const std::vector<std::shared_ptr<Tensor>>& outputs,
               const std::vector<std::shared_ptr<Tensor>>& inputs) override;
@@ -182,7 +188,8 @@ public:
         create_output_tensor(size_t output_index, size_t pipeline_depth) override;
 
 protected:
-    INTExecutable(const std::string& model_string);
+    INTExecutable(const std::string& model_string,
+                  const std::shared_ptr<TaskScheduler>& scheduler = nullptr);
 
     template <typename T>
     std::vector<T> as_vector(const HostTensor* tensor) const
@@ -273,17 +280,99 @@ protected:
     AxisSet as_axis_set(const HostTensor* tensor) const;
     AxisVector as_axis_vector(const HostTensor* tensor) const;
 
+    /// \brief Everything call() needs to dispatch one op, resolved at compile time.
+    ///
+    /// Tensors are referenced by their slot index in CallContext::m_tensor_slots.
+    struct NodeCall
+    {
+        std::shared_ptr<Node> m_node;
+        element::Type m_type;
+        std::vector<size_t> m_input_slots;
+        std::vector<size_t> m_output_slots;
+    };
+
+    /// \brief The memory one call() works in: the intermediates, carved out of a pool of
+    ///        their own, and the argument vectors of every node call, kept here so that
+    ///        binding them on each call does not allocate.
+    ///
+    /// Each call in flight checks a context out of m_free_contexts, so concurrent calls do
+    /// not share intermediates.
+    struct CallContext
+    {
+        std::unique_ptr<AlignedBuffer> m_memory_pool;
+        std::vector<std::shared_ptr<HostTensor>> m_tensor_slots;
+        std::vector<std::vector<std::shared_ptr<HostTensor>>> m_inputs;
+        std::vector<std::vector<std::shared_ptr<HostTensor>>> m_outputs;
+    };
+
     std::shared_ptr<ngraph::op::v0::Parameter> get_parameter(size_t index) const;
     std::shared_ptr<ngraph::op::v0::Result> get_result(size_t index) const;
     int get_alignment() const { return 64; }
+    /// \brief Assign a slot to every tensor in m_function and lay the static intermediates
+    ///        out in a pool using the offsets computed by pass::MemoryLayout.
+    ///
+    /// With a scheduler m_task_graph gets the data and control dependencies between node
+    /// calls, and the ones that keep node calls sharing pool memory apart.
+    void build_call_plan();
+    /// \brief Record that node call \p task writes \p slot to bytes [\p begin, \p end) of
+    ///        the pool, after every node call that used the slots there before
+    void claim_pool_range(size_t begin,
+                          size_t end,
+                          size_t slot,
+                          size_t task,
+                          std::map<size_t, std::pair<size_t, size_t>>& pool_owners,
+                          std::unordered_map<size_t, std::vector<size_t>>& slot_users);
+    /// \brief Create a context with its own pool and intermediates, laid out as
+    ///        build_call_plan decided
+    std::unique_ptr<CallContext> create_call_context() const;
+    /// \brief Take a free context, or create one if every context is in use by a call
+    std::unique_ptr<CallContext> acquire_call_context();
+    void release_call_context(std::unique_ptr<CallContext> context);
+    void run_node_call(size_t index, CallContext& context);
+    /// \brief Run the body of \p tensor_iterator once per iteration.
+    ///
+    /// Parts of the sliced inputs and concatenated outputs that are contiguous are bound to
+    /// the body as views, and merged inputs take the body result of the previous iteration
+    /// without a copy.
+    void run_tensor_iterator(const op::v0::TensorIterator& tensor_iterator,
+                             const std::vector<std::shared_ptr<HostTensor>>& out,
+                             const std::vector<std::shared_ptr<HostTensor>>& args);
+    static element::Type get_dispatch_type(const Node& node);
     bool m_is_compiled = false;
     bool m_nan_check_enabled = false;
     bool m_performance_counters_enabled = false;
     std::shared_ptr<Function> m_function;
     std::unordered_map<std::shared_ptr<const Node>, stopwatch> m_timer_map;
     NodeVector m_nodes;
+    std::vector<NodeCall> m_node_calls;
+    std::shared_ptr<TaskScheduler> m_scheduler;
+    TaskGraph m_task_graph;
+    size_t m_slot_count = 0;
+    std::vector<size_t> m_parameter_slots;
+    std::vector<size_t> m_result_slots;
+    // Intermediates without a static shape or type, recreated on every call
+    std::vector<std::pair<size_t, Output<Node>>> m_dynamic_slots;
+    // Intermediates with a static shape, each context makes them at the given pool offset, or
+    // with storage of their own if the offset is npos
+    struct StaticSlot
+    {
+        size_t m_slot;
+        Output<Node> m_output;
+        size_t m_pool_offset;
+    };
+    std::vector<StaticSlot> m_static_slots;
+    // Size of the pool of each context
+    size_t m_pool_size = 0;
+    std::vector<std::unique_ptr<CallContext>> m_free_contexts;
+    std::mutex m_free_contexts_mutex;
+    // Each op is timed by a single stopwatch, so calls that time ops are serialized
+    std::mutex m_timed_call_mutex;
     std::unordered_map<const Node*, std::shared_ptr<State>> m_states;
+    // Ops create their state on first use, possibly from several scheduler threads
+    std::mutex m_states_mutex;
     std::set<std::string> m_unsupported_op_name_list;
+    // The bodies of the TensorIterators in m_function, compiled once by build_call_plan
+    std::unordered_map<const Node*, std::shared_ptr<INTExecutable>> m_tensor_iterator_bodies;
 
     static OP_TYPEID get_typeid(const Node& node);
 
@@ -668,6 +757,16 @@ protected:
                 reference::convert_to_bool<T>(
                     args[0]->get_data_ptr<const T>(), out[0]->get_data_ptr<char>(), element_count);
                 break;
+            case element::Type_t::bf16:
+                reference::convert<T>(args[0]->get_data_ptr<const T>(),
+                                      out[0]->get_data_ptr<bfloat16>(),
+                                      element_count);
+                break;
+            case element::Type_t::f16:
+                reference::convert<T>(args[0]->get_data_ptr<const T>(),
+                                      out[0]->get_data_ptr<float16>(),
+                                      element_count);
+                break;
             case element::Type_t::f32:
                 reference::convert<T>(
                     args[0]->get_data_ptr<const T>(), out[0]->get_data_ptr<float>(), element_count);
@@ -720,8 +819,6 @@ protected:
             case element::Type_t::undefined:
             case element::Type_t::dynamic:
             case element::Type_t::u1:
-            case element::Type_t::bf16:
-            case element::Type_t::f16:
                 ss << "unsupported element type " << type << " op Convert";
                 throw std::runtime_error(ss.str());
             }
@@ -1079,16 +1176,21 @@ protected:
         case OP_TYPEID::GenerateMask_v0:
         {
             bool use_seed = static_cast<bool>(args[2]->get_data_ptr<const int32_t>()[0]);
-            if (m_states.count(&node) == 0)
+            BernoulliRNGState* state;
             {
-                const op::v0::GenerateMask* gm = static_cast<const op::v0::GenerateMask*>(&node);
-                auto seed = use_seed ? gm->get_seed() : 0;
-                m_states[&node] =
-                    std::unique_ptr<State>(new BernoulliRNGState(seed, gm->get_probability()));
+                std::lock_guard<std::mutex> lock(m_states_mutex);
+                if (m_states.count(&node) == 0)
+                {
+                    const op::v0::GenerateMask* gm =
+                        static_cast<const op::v0::GenerateMask*>(&node);
+                    auto seed = use_seed ? gm->get_seed() : 0;
+                    m_states[&node] =
+                        std::unique_ptr<State>(new BernoulliRNGState(seed, gm->get_probability()));
+                }
+                state = static_cast<BernoulliRNGState*>(m_states.at(&node).get());
             }
 
             bool training = static_cast<bool>(args[0]->get_data_ptr<const T>()[0]);
-            auto state = static_cast<BernoulliRNGState*>(m_states.at(&node).get());
             Shape output_shape = args[0]->get_shape();
             size_t element_count = shape_size(output_shape);
             out[0]->set_shape(output_shape);
@@ -1661,12 +1763,15 @@ protected:
             // static output shapes anyway.
             bool use_fixed_seed = static_cast<bool>(args[3]->get_data_ptr<const char>()[0]);
 
-            if (m_states.count(&node) == 0)
+            UniformRNGState* state;
             {
-                m_states[&node] = std::unique_ptr<UniformRNGState>(new UniformRNGState());
+                std::lock_guard<std::mutex> lock(m_states_mutex);
+                if (m_states.count(&node) == 0)
+                {
+                    m_states[&node] = std::unique_ptr<UniformRNGState>(new UniformRNGState());
+                }
+                state = static_cast<UniformRNGState*>(m_states.at(&node).get());
             }
-
-            auto state = static_cast<UniformRNGState*>(m_states.at(&node).get());
             size_t element_count = shape_size(node.get_output_shape(0));
             if (!use_fixed_seed)
             {
@@ -2152,6 +2257,11 @@ protected:
                 args[0]->get_data_ptr<const T>(), out[0]->get_data_ptr<T>(), element_count);
             break;
         }
+        case OP_TYPEID::TensorIterator_v0:
+        {
+            run_tensor_iterator(static_cast<const op::v0::TensorIterator&>(node), out, args);
+            break;
+        }
         case OP_TYPEID::TopK_v0:
         {
             const op::v0::TopK* topk = static_cast<const op::v0::TopK*>(&node);
@@ -2292,7 +2402,6 @@ protected:
         case OP_TYPEID::SquaredDifference_v0:
         case OP_TYPEID::Squeeze_v0:
         case OP_TYPEID::Stack_v0:
-        case OP_TYPEID::TensorIterator_v0:
         case OP_TYPEID::Tile_v0:
         case OP_TYPEID::TopK_v1:
         case OP_TYPEID::TopK_v3:
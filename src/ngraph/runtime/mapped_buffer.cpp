@@ -0,0 +1,127 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#ifdef _WIN32
+#include <fstream>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "ngraph/except.hpp"
+#include "ngraph/runtime/mapped_buffer.hpp"
+
+using namespace ngraph;
+using namespace std;
+
+runtime::MappedBuffer::MappedBuffer(const string& path)
+{
+    map(path, 0, 0, true);
+}
+
+runtime::MappedBuffer::MappedBuffer(const string& path, size_t offset, size_t size)
+{
+    map(path, offset, size, false);
+}
+
+#ifdef _WIN32
+void runtime::MappedBuffer::map(const string& path, size_t offset, size_t size, bool whole_file)
+{
+    ifstream in(path, ios_base::binary | ios_base::in);
+    if (!in)
+    {
+        throw ngraph_error("Unable to open '" + path + "'");
+    }
+    if (whole_file)
+    {
+        in.seekg(0, ios_base::end);
+        size = static_cast<size_t>(in.tellg());
+    }
+    in.seekg(offset, ios_base::beg);
+    AlignedBuffer buffer(size);
+    in.read(buffer.get_ptr<char>(), size);
+    if (static_cast<size_t>(in.gcount()) != size)
+    {
+        throw ngraph_error("Unable to read " + to_string(size) + " bytes at offset " +
+                           to_string(offset) + " of '" + path + "'");
+    }
+    AlignedBuffer::operator=(move(buffer));
+    m_byte_size = size;
+}
+
+runtime::MappedBuffer::~MappedBuffer()
+{
+}
+#else
+void runtime::MappedBuffer::map(const string& path, size_t offset, size_t size, bool whole_file)
+{
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd == -1)
+    {
+        throw ngraph_error("Unable to open '" + path + "'");
+    }
+    struct stat st;
+    if (fstat(fd, &st) == -1)
+    {
+        ::close(fd);
+        throw ngraph_error("Unable to size '" + path + "'");
+    }
+    size_t file_size = static_cast<size_t>(st.st_size);
+    if (whole_file)
+    {
+        size = file_size;
+    }
+    if (offset > file_size || size > file_size - offset)
+    {
+        ::close(fd);
+        throw ngraph_error("Range of " + to_string(size) + " bytes at offset " +
+                           to_string(offset) + " is past the end of '" + path + "'");
+    }
+    if (size > 0)
+    {
+        size_t page_offset = offset % static_cast<size_t>(sysconf(_SC_PAGESIZE));
+        m_mapping_size = page_offset + size;
+        m_mapping = mmap(nullptr,
+                         m_mapping_size,
+                         PROT_READ | PROT_WRITE,
+                         MAP_PRIVATE,
+                         fd,
+                         static_cast<off_t>(offset - page_offset));
+        if (m_mapping == MAP_FAILED)
+        {
+            m_mapping = nullptr;
+            ::close(fd);
+            throw ngraph_error("Unable to map '" + path + "'");
+        }
+        m_aligned_buffer = static_cast<char*>(m_mapping) + page_offset;
+    }
+    // The mapping holds its own reference to the file
+    ::close(fd);
+    m_byte_size = size;
+}
+
+runtime::MappedBuffer::~MappedBuffer()
+{
+    if (m_mapping)
+    {
+        munmap(m_mapping, m_mapping_size);
+    }
+    m_aligned_buffer = nullptr;
+    m_byte_size = 0;
+}
+#endif
@@ -0,0 +1,53 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+#include "ngraph/runtime/aligned_buffer.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        class MappedBuffer;
+    }
+}
+
+/// \brief The contents of a file, or of a range of it, memory mapped rather than read.
+///
+/// The mapping is private and copy on write: the pages are shared with the page cache, and
+/// so with every other process that maps the file, until they are written to, and writes
+/// never reach the file. On Windows the range is read into memory instead. The data is only
+/// as aligned as \p offset is.
+class NGRAPH_API ngraph::runtime::MappedBuffer : public ngraph::runtime::AlignedBuffer
+{
+public:
+    /// \brief Map the whole of the file at \p path
+    MappedBuffer(const std::string& path);
+    /// \brief Map \p size bytes of the file at \p path starting at \p offset
+    MappedBuffer(const std::string& path, size_t offset, size_t size);
+    ~MappedBuffer() override;
+
+private:
+    void map(const std::string& path, size_t offset, size_t size, bool whole_file);
+
+    // Start and length of the mapping, which begins on a page boundary
+    void* m_mapping = nullptr;
+    size_t m_mapping_size = 0;
+};
@@ -17,8 +17,9 @@
 #pragma once
 
 #include <cmath>
+#include <cstring>
 
-#include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/reference/loop_nest.hpp"
 #include "ngraph/shape_util.hpp"
 
 namespace ngraph
@@ -34,24 +35,21 @@ namespace ngraph
                 // take the first elements (i.e. 0 indices) in out_shape - axis as maximums
                 memset(out, 0, shape_size(out_shape) * sizeof(U));
 
-                AxisVector av{axis};
-                CoordinateTransform input_transform(in_shape);
-
-                for (const Coordinate& input_coord : input_transform)
-                {
-                    Coordinate output_coord = reduce(input_coord, av);
-                    CoordinateTransform output_transform(out_shape);
-
-                    auto min_index = static_cast<size_t>(out[output_transform.index(output_coord)]);
-                    auto min_coord = input_coord;
-                    min_coord[axis] = min_index;
-                    if (arg[input_transform.index(input_coord)] >
-                        arg[input_transform.index(min_coord)])
+                // The third offset is the position along the axis
+                Strides in_strides = row_major_strides(in_shape);
+                Strides axis_position(in_shape.size(), 0);
+                axis_position[axis] = 1;
+                LoopNest<3> loops(
+                    in_shape,
+                    {in_strides, reduction_strides(in_shape, AxisSet{axis}), axis_position});
+                loops.for_each([&](const LoopNest<3>::Offsets& offsets) {
+                    auto best_index = static_cast<size_t>(out[offsets[1]]);
+                    size_t best_offset = offsets[0] - (offsets[2] - best_index) * in_strides[axis];
+                    if (arg[offsets[0]] > arg[best_offset])
                     {
-                        out[output_transform.index(output_coord)] =
-                            static_cast<U>(input_coord[axis]);
+                        out[offsets[1]] = static_cast<U>(offsets[2]);
                     }
-                }
+                });
             }
         }
     }
@@ -16,10 +16,12 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstddef>
 
-#include "ngraph/coordinate_transform.hpp"
+#include "ngraph/check.hpp"
 #include "ngraph/op/util/attr_types.hpp"
+#include "ngraph/runtime/reference/loop_nest.hpp"
 #include "ngraph/shape_util.hpp"
 
 namespace ngraph
@@ -63,106 +65,146 @@ namespace ngraph
                     }
                     break;
                 case op::AutoBroadcastType::NUMPY:
-                    // We'll be using CoordinateTransform to handle the broadcasting. The general
-                    // procedure is as follows:
+                    // Both args are walked over the output shape with strides that broadcast
+                    // them, numpy style:
                     //
                     // (1) Left pad the shorter of the two shapes with ones.
-                    // (2) Squeeze (remove ones from) both shapes, and record the squeezed axis
-                    //     indices.
-                    // (3) Using CoordinateTransform, broadcast both args to the final output
-                    //     shape. The "broadcasted axes" will be those that were squeezed in step
-                    //     2.
+                    // (2) Each output axis takes the length of whichever arg is not one there.
+                    // (3) An arg gets a stride of zero along the axes where its padded length is
+                    //     one, so the same element is reused along them.
                     //
                     // Example:
                     //
-                    //    Input shape->Padded shape->Squeezed Shape/Squeezed Axes
-                    //    -----------  ------------  ----------------------------
-                    // a: [ 3, 2, 1]   [ 3, 2, 1]    [ 3, 2   ]     {2}
-                    // b: [    1, 6]   [ 1, 1, 6]    [       6]     {0,1}
+                    //    Input shape->Padded shape->Strides
+                    //    -----------  ------------  ---------
+                    // a: [ 3, 2, 1]   [ 3, 2, 1]    [2, 1, 0]
+                    // b: [    1, 6]   [ 1, 1, 6]    [0, 0, 1]
                     //                   |  |  |
                     //                   v  v  v
                     //                 Output shape
                     //                 ------------
                     //                 [ 3, 2, 6]
                     {
+                        size_t rank = std::max(arg0_shape.size(), arg1_shape.size());
                         Shape arg0_padded_shape = arg0_shape;
                         Shape arg1_padded_shape = arg1_shape;
+                        arg0_padded_shape.insert(
+                            arg0_padded_shape.begin(), rank - arg0_shape.size(), 1);
+                        arg1_padded_shape.insert(
+                            arg1_padded_shape.begin(), rank - arg1_shape.size(), 1);
 
-                        while (arg0_padded_shape.size() < arg1_padded_shape.size())
+                        Shape output_shape(rank);
+                        for (size_t i = 0; i < rank; i++)
                         {
-                            arg0_padded_shape.insert(arg0_padded_shape.begin(), 1);
-                        }
-
-                        while (arg1_padded_shape.size() < arg0_padded_shape.size())
-                        {
-                            arg1_padded_shape.insert(arg1_padded_shape.begin(), 1);
+                            output_shape[i] = arg0_padded_shape[i] == 1 ? arg1_padded_shape[i]
+                                                                        : arg0_padded_shape[i];
                         }
 
-                        Shape arg0_squeezed_shape;
-                        Shape arg1_squeezed_shape;
-                        AxisSet arg0_squeezed_axes;
-                        AxisSet arg1_squeezed_axes;
-                        Shape output_shape;
-
-                        for (size_t i = 0; i < arg0_padded_shape.size(); i++)
+                        // Classify the broadcast once so the common patterns get plain
+                        // contiguous loops the compiler can vectorize
+                        size_t out_size = shape_size(output_shape);
+                        size_t arg0_size = shape_size(arg0_shape);
+                        size_t arg1_size = shape_size(arg1_shape);
+                        if (arg0_size == out_size && arg1_size == out_size)
                         {
-                            if (arg0_padded_shape[i] == 1)
-                            {
-                                arg0_squeezed_axes.insert(i);
-                            }
-                            else
+                            // Nothing is broadcast, only ones were padded or inserted
+                            for (size_t i = 0; i < out_size; i++)
                             {
-                                arg0_squeezed_shape.push_back(arg0_padded_shape[i]);
+                                out[i] = elementwise_functor(arg0[i], arg1[i]);
                             }
-
-                            if (arg1_padded_shape[i] == 1)
+                            break;
+                        }
+                        if (arg0_size == 1)
+                        {
+                            const T scalar = arg0[0];
+                            for (size_t i = 0; i < out_size; i++)
                             {
-                                arg1_squeezed_axes.insert(i);
+                                out[i] = elementwise_functor(scalar, arg1[i]);
                             }
-                            else
+                            break;
+                        }
+                        if (arg1_size == 1)
+                        {
+                            const T scalar = arg1[0];
+                            for (size_t i = 0; i < out_size; i++)
                             {
-                                arg1_squeezed_shape.push_back(arg1_padded_shape[i]);
+                                out[i] = elementwise_functor(arg0[i], scalar);
                             }
-
-                            output_shape.push_back(arg0_padded_shape[i] == 1
-                                                       ? arg1_padded_shape[i]
-                                                       : arg0_padded_shape[i]);
+                            break;
                         }
 
-                        CoordinateTransform arg0_transform(arg0_squeezed_shape);
-                        CoordinateTransform arg1_transform(arg1_squeezed_shape);
-                        CoordinateTransform output_transform(output_shape);
-
-                        for (const Coordinate& output_coord : output_transform)
+                        // Otherwise the runs along the innermost merged axis are contiguous in
+                        // the output and either contiguous or a single repeated element in
+                        // each arg, e.g. a trailing vector added to every row or the rows of
+                        // an outer product.
+                        using Offsets = LoopNest<3>::Offsets;
+                        LoopNest<3> loops(output_shape,
+                                          {row_major_strides(output_shape),
+                                           broadcast_strides(arg0_padded_shape, rank),
+                                           broadcast_strides(arg1_padded_shape, rank)});
+                        const Offsets inner_strides = loops.get_inner_strides();
+                        if (inner_strides == Offsets{1, 1, 1})
+                        {
+                            loops.for_each_run(
+                                [&](const Offsets& offsets, size_t count, const Offsets&) {
+                                    U* out_run = out + offsets[0];
+                                    const T* arg0_run = arg0 + offsets[1];
+                                    const T* arg1_run = arg1 + offsets[2];
+                                    for (size_t i = 0; i < count; i++)
+                                    {
+                                        out_run[i] = elementwise_functor(arg0_run[i], arg1_run[i]);
+                                    }
+                                });
+                        }
+                        else if (inner_strides == Offsets{1, 0, 1})
+                        {
+                            loops.for_each_run(
+                                [&](const Offsets& offsets, size_t count, const Offsets&) {
+                                    U* out_run = out + offsets[0];
+                                    const T scalar = arg0[offsets[1]];
+                                    const T* arg1_run = arg1 + offsets[2];
+                                    for (size_t i = 0; i < count; i++)
+                                    {
+                                        out_run[i] = elementwise_functor(scalar, arg1_run[i]);
+                                    }
+                                });
+                        }
+                        else if (inner_strides == Offsets{1, 1, 0})
+                        {
+                            loops.for_each_run(
+                                [&](const Offsets& offsets, size_t count, const Offsets&) {
+                                    U* out_run = out + offsets[0];
+                                    const T* arg0_run = arg0 + offsets[1];
+                                    const T scalar = arg1[offsets[2]];
+                                    for (size_t i = 0; i < count; i++)
+                                    {
+                                        out_run[i] = elementwise_functor(arg0_run[i], scalar);
+                                    }
+                                });
+                        }
+                        else
                         {
-                            Coordinate arg0_coord = reduce(output_coord, arg0_squeezed_axes);
-                            Coordinate arg1_coord = reduce(output_coord, arg1_squeezed_axes);
-                            out[output_transform.index(output_coord)] =
-                                elementwise_functor(arg0[arg0_transform.index(arg0_coord)],
-                                                    arg1[arg1_transform.index(arg1_coord)]);
+                            loops.for_each([&](const Offsets& offsets) {
+                                out[offsets[0]] =
+                                    elementwise_functor(arg0[offsets[1]], arg1[offsets[2]]);
+                            });
                         }
                     }
                     break;
                 case op::AutoBroadcastType::PDPD:
-                    // We'll be using CoordinateTransform to handle the broadcasting. No need to
-                    // process arg0 and output shape will be the same as arg0. We need to process
-                    // arg1 and the general procedure is as follows:
+                    // No need to process arg0 and output shape will be the same as arg0. arg1
+                    // is walked with broadcasting strides, after:
                     //
                     // (1) Trim trailing ones from arg1 shape.
                     // (2) Left and right pad arg1 to match arg0 shape. Axis is the index start
                     //     to align between arg0 and arg1.
-                    // (3) Squeeze (remove ones from) arg1 shape, and record the squeezed axis
-                    //     indices.
-                    // (3) Using CoordinateTransform, broadcast arg1 to the final output
-                    //     shape. The "broadcasted axes" will be those that were squeezed in step
-                    //     23.
                     //
                     // Example:
                     //
-                    //    Input shape->   Padded shape->   Squeezed Shape/Squeezed Axes
+                    //    Input shape->   Padded shape->   Strides
                     //    -----------  ------------  ----------------------------
-                    // a: [ 3, 4, 5, 6]   [ 3, 4, 5, 6]    [ 3, 4, 5, 6]
-                    // b: [    4, 5,  ]   [ 1, 4, 5, 1]    [    4, 5   ]     {0,3}
+                    // a: [ 3, 4, 5, 6]   [ 3, 4, 5, 6]    [120, 30, 6, 1]
+                    // b: [    4, 5,  ]   [ 1, 4, 5, 1]    [  0,  5, 1, 0]
                     //                      |  |  |
                     //                      v  v  v
                     //                     Output shape
@@ -192,32 +234,14 @@ namespace ngraph
                             arg1_padded_shape.insert(arg1_padded_shape.end(), 1);
                         }
 
-                        Shape arg1_squeezed_shape;
-                        AxisSet arg1_squeezed_axes;
-
-                        for (size_t i = 0; i < arg0_shape.size(); i++)
-                        {
-                            if (arg1_padded_shape[i] == 1)
-                            {
-                                arg1_squeezed_axes.insert(i);
-                            }
-                            else
-                            {
-                                arg1_squeezed_shape.push_back(arg1_padded_shape[i]);
-                            }
-                        }
-
-                        CoordinateTransform arg0_transform(arg0_shape);
-                        CoordinateTransform arg1_transform(arg1_squeezed_shape);
-                        CoordinateTransform output_transform(arg0_shape);
-
-                        for (const Coordinate& output_coord : output_transform)
-                        {
-                            Coordinate arg1_coord = reduce(output_coord, arg1_squeezed_axes);
-                            out[output_transform.index(output_coord)] =
-                                elementwise_functor(arg0[arg0_transform.index(output_coord)],
-                                                    arg1[arg1_transform.index(arg1_coord)]);
-                        }
+                        size_t rank = arg0_shape.size();
+                        LoopNest<2> loops(arg0_shape,
+                                          {row_major_strides(arg0_shape),
+                                           broadcast_strides(arg1_padded_shape, rank)});
+                        loops.for_each([&](const LoopNest<2>::Offsets& offsets) {
+                            out[offsets[0]] =
+                                elementwise_functor(arg0[offsets[0]], arg1[offsets[1]]);
+                        });
                     }
                 }
             }
@@ -264,82 +288,34 @@ namespace ngraph
                 case op::AutoBroadcastType::NUMPY:
                     // Uses same approach as autobroadcast_binop.
                     {
+                        size_t rank = std::max(arg1_shape.size(), arg2_shape.size());
+                        NGRAPH_CHECK(arg0_shape.size() <= rank);
                         Shape arg0_padded_shape = arg0_shape;
                         Shape arg1_padded_shape = arg1_shape;
                         Shape arg2_padded_shape = arg2_shape;
-
-                        while (arg1_padded_shape.size() < arg2_padded_shape.size())
-                        {
-                            arg1_padded_shape.insert(arg1_padded_shape.begin(), 1);
-                        }
-
-                        while (arg2_padded_shape.size() < arg1_padded_shape.size())
-                        {
-                            arg2_padded_shape.insert(arg2_padded_shape.begin(), 1);
-                        }
-
-                        while (arg0_padded_shape.size() < arg1_padded_shape.size())
-                        {
-                            arg0_padded_shape.insert(arg0_padded_shape.begin(), 1);
-                        }
-
-                        Shape arg0_squeezed_shape;
-                        Shape arg1_squeezed_shape;
-                        Shape arg2_squeezed_shape;
-                        AxisSet arg0_squeezed_axes;
-                        AxisSet arg1_squeezed_axes;
-                        AxisSet arg2_squeezed_axes;
-                        Shape output_shape;
-
-                        for (size_t i = 0; i < arg1_padded_shape.size(); i++)
+                        arg0_padded_shape.insert(
+                            arg0_padded_shape.begin(), rank - arg0_shape.size(), 1);
+                        arg1_padded_shape.insert(
+                            arg1_padded_shape.begin(), rank - arg1_shape.size(), 1);
+                        arg2_padded_shape.insert(
+                            arg2_padded_shape.begin(), rank - arg2_shape.size(), 1);
+
+                        Shape output_shape(rank);
+                        for (size_t i = 0; i < rank; i++)
                         {
-                            if (arg1_padded_shape[i] == 1)
-                            {
-                                arg1_squeezed_axes.insert(i);
-                            }
-                            else
-                            {
-                                arg1_squeezed_shape.push_back(arg1_padded_shape[i]);
-                            }
-
-                            if (arg2_padded_shape[i] == 1)
-                            {
-                                arg2_squeezed_axes.insert(i);
-                            }
-                            else
-                            {
-                                arg2_squeezed_shape.push_back(arg2_padded_shape[i]);
-                            }
-
-                            if (arg0_padded_shape[i] == 1)
-                            {
-                                arg0_squeezed_axes.insert(i);
-                            }
-                            else
-                            {
-                                arg0_squeezed_shape.push_back(arg0_padded_shape[i]);
-                            }
-
-                            output_shape.push_back(arg1_padded_shape[i] == 1
-                                                       ? arg2_padded_shape[i]
-                                                       : arg1_padded_shape[i]);
+                            output_shape[i] = arg1_padded_shape[i] == 1 ? arg2_padded_shape[i]
+                                                                        : arg1_padded_shape[i];
                         }
 
-                        CoordinateTransform arg0_transform(arg0_squeezed_shape);
-                        CoordinateTransform arg1_transform(arg1_squeezed_shape);
-                        CoordinateTransform arg2_transform(arg2_squeezed_shape);
-                        CoordinateTransform output_transform(output_shape);
-
-                        for (const Coordinate& output_coord : output_transform)
-                        {
-                            Coordinate arg0_coord = reduce(output_coord, arg0_squeezed_axes);
-                            Coordinate arg1_coord = reduce(output_coord, arg1_squeezed_axes);
-                            Coordinate arg2_coord = reduce(output_coord, arg2_squeezed_axes);
-                            out[output_transform.index(output_coord)] =
-                                elementwise_functor(arg0[arg0_transform.index(arg0_coord)],
-                                                    arg1[arg1_transform.index(arg1_coord)],
-                                                    arg2[arg2_transform.index(arg2_coord)]);
-                        }
+                        LoopNest<4> loops(output_shape,
+                                          {row_major_strides(output_shape),
+                                           broadcast_strides(arg0_padded_shape, rank),
+                                           broadcast_strides(arg1_padded_shape, rank),
+                                           broadcast_strides(arg2_padded_shape, rank)});
+                        loops.for_each([&](const LoopNest<4>::Offsets& offsets) {
+                            out[offsets[0]] = elementwise_functor(
+                                arg0[offsets[1]], arg1[offsets[2]], arg2[offsets[3]]);
+                        });
                     }
                     break;
                 case op::AutoBroadcastType::PDPD:
@@ -384,45 +360,15 @@ namespace ngraph
                         arg2_padded_shape.insert(arg2_padded_shape.end(), 1);
                     }
 
-                    Shape arg0_squeezed_shape;
-                    AxisSet arg0_squeezed_axes;
-                    Shape arg2_squeezed_shape;
-                    AxisSet arg2_squeezed_axes;
-
-                    for (size_t i = 0; i < arg1_shape.size(); i++)
-                    {
-                        if (arg0_padded_shape[i] == 1)
-                        {
-                            arg0_squeezed_axes.insert(i);
-                        }
-                        else
-                        {
-                            arg0_squeezed_shape.push_back(arg0_padded_shape[i]);
-                        }
-                        if (arg2_padded_shape[i] == 1)
-                        {
-                            arg2_squeezed_axes.insert(i);
-                        }
-                        else
-                        {
-                            arg2_squeezed_shape.push_back(arg2_padded_shape[i]);
-                        }
-                    }
-
-                    CoordinateTransform arg0_transform(arg0_squeezed_shape);
-                    CoordinateTransform arg1_transform(arg1_shape);
-                    CoordinateTransform arg2_transform(arg2_squeezed_shape);
-                    CoordinateTransform output_transform(arg1_shape);
-
-                    for (const Coordinate& output_coord : output_transform)
-                    {
-                        Coordinate arg0_coord = reduce(output_coord, arg0_squeezed_axes);
-                        Coordinate arg2_coord = reduce(output_coord, arg2_squeezed_axes);
-                        out[output_transform.index(output_coord)] =
-                            elementwise_functor(arg0[arg0_transform.index(arg0_coord)],
-                                                arg1[arg1_transform.index(output_coord)],
-                                                arg2[arg2_transform.index(arg2_coord)]);
-                    }
+                    size_t rank = arg1_shape.size();
+                    LoopNest<3> loops(arg1_shape,
+                                      {row_major_strides(arg1_shape),
+                                       broadcast_strides(arg0_padded_shape, rank),
+                                       broadcast_strides(arg2_padded_shape, rank)});
+                    loops.for_each([&](const LoopNest<3>::Offsets& offsets) {
+                        out[offsets[0]] = elementwise_functor(
+                            arg0[offsets[1]], arg1[offsets[0]], arg2[offsets[2]]);
+                    });
                 }
                 }
             }
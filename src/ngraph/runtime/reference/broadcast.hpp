@@ -18,7 +18,8 @@
 
 #include <cmath>
 
-#include "ngraph/coordinate_transform.hpp"
+#include "ngraph/check.hpp"
+#include "ngraph/runtime/reference/loop_nest.hpp"
 #include "ngraph/shape_util.hpp"
 
 namespace ngraph
@@ -53,15 +54,14 @@ namespace ngraph
                         adjusted_axes.insert(axis);
                     }
                 }
-                CoordinateTransform input_transform(adjusted_in_shape);
-                CoordinateTransform output_transform(out_shape);
+                NGRAPH_CHECK(reduce(out_shape, adjusted_axes) == adjusted_in_shape);
 
-                for (const Coordinate& output_coord : output_transform)
-                {
-                    Coordinate input_coord = reduce(output_coord, adjusted_axes);
-                    out[output_transform.index(output_coord)] =
-                        arg[input_transform.index(input_coord)];
-                }
+                LoopNest<2> loops(
+                    out_shape,
+                    {row_major_strides(out_shape), reduction_strides(out_shape, adjusted_axes)});
+                loops.for_each([&](const LoopNest<2>::Offsets& offsets) {
+                    out[offsets[0]] = arg[offsets[1]];
+                });
             }
         }
     }
@@ -23,6 +23,8 @@
 #include "ngraph/axis_vector.hpp"
 #include "ngraph/coordinate_transform.hpp"
 #include "ngraph/runtime/reference/reverse.hpp"
+#include "ngraph/type/bfloat16.hpp"
+#include "ngraph/type/float16.hpp"
 #include "ngraph/util.hpp"
 
 namespace ngraph
@@ -49,6 +51,18 @@ namespace ngraph
                 using type = long double;
             };
 
+            template <>
+            struct widen<float16>
+            {
+                using type = float;
+            };
+
+            template <>
+            struct widen<bfloat16>
+            {
+                using type = float;
+            };
+
             // in: NC_I...
             // filter: C_OC_I...
             // out: NC_O...
@@ -0,0 +1,175 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace reference
+        {
+            /// \brief Matrix product of a row-major [m, k] arg0 and a row-major [k, n] arg1
+            ///        into a row-major [m, n] out.
+            ///
+            /// Blocks of both args are packed into ACCUMULATION, less their zero points, and
+            /// multiplied into a 4 x 8 tile of sums kept in registers. The blocks are sized to
+            /// stay in cache. Every output is still summed over k in order starting from zero,
+            /// so the result is the same as the naive loop.
+            ///
+            /// \param finish Converts each finished ACCUMULATION sum to OUTPUT.
+            template <typename INPUT0,
+                      typename INPUT1,
+                      typename OUTPUT,
+                      typename ACCUMULATION,
+                      typename Finish>
+            void gemm(const INPUT0* arg0,
+                      const INPUT1* arg1,
+                      OUTPUT* out,
+                      size_t m,
+                      size_t n,
+                      size_t k,
+                      ACCUMULATION arg0_zero_point,
+                      ACCUMULATION arg1_zero_point,
+                      Finish finish)
+            {
+                constexpr size_t tile_rows = 4;
+                constexpr size_t tile_columns = 8;
+                constexpr size_t block_rows = 64;
+                constexpr size_t block_columns = 256;
+                constexpr size_t block_depth = 256;
+
+                // Small products only get buffers as large as they need
+                size_t max_rows = std::min(block_rows, (m + tile_rows - 1) / tile_rows * tile_rows);
+                size_t max_cols =
+                    std::min(block_columns, (n + tile_columns - 1) / tile_columns * tile_columns);
+                size_t max_depth = std::min(block_depth, k);
+                std::vector<ACCUMULATION> packed_arg0(max_rows * max_depth);
+                std::vector<ACCUMULATION> packed_arg1(max_depth * max_cols);
+                std::vector<ACCUMULATION> sums(max_rows * max_cols);
+
+                for (size_t col0 = 0; col0 < n; col0 += block_columns)
+                {
+                    size_t cols = std::min(block_columns, n - col0);
+                    for (size_t row0 = 0; row0 < m; row0 += block_rows)
+                    {
+                        size_t rows = std::min(block_rows, m - row0);
+                        std::fill(sums.begin(), sums.end(), ACCUMULATION(0));
+
+                        for (size_t depth0 = 0; depth0 < k; depth0 += block_depth)
+                        {
+                            size_t depth = std::min(block_depth, k - depth0);
+
+                            // arg0 goes tile by tile, each tile column by column. Rows past
+                            // the end are padded with zeros so every tile is full.
+                            for (size_t tile = 0; tile < rows; tile += tile_rows)
+                            {
+                                ACCUMULATION* packed = &packed_arg0[tile * depth];
+                                for (size_t p = 0; p < depth; ++p)
+                                {
+                                    for (size_t i = 0; i < tile_rows; ++i)
+                                    {
+                                        size_t row = tile + i;
+                                        packed[p * tile_rows + i] =
+                                            row < rows
+                                                ? static_cast<ACCUMULATION>(
+                                                      arg0[(row0 + row) * k + depth0 + p]) -
+                                                      arg0_zero_point
+                                                : ACCUMULATION(0);
+                                    }
+                                }
+                            }
+
+                            // arg1 goes tile by tile, each tile row by row
+                            for (size_t tile = 0; tile < cols; tile += tile_columns)
+                            {
+                                ACCUMULATION* packed = &packed_arg1[tile * depth];
+                                for (size_t p = 0; p < depth; ++p)
+                                {
+                                    const INPUT1* row = arg1 + (depth0 + p) * n + col0;
+                                    for (size_t j = 0; j < tile_columns; ++j)
+                                    {
+                                        size_t col = tile + j;
+                                        packed[p * tile_columns + j] =
+                                            col < cols
+                                                ? static_cast<ACCUMULATION>(row[col]) -
+                                                      arg1_zero_point
+                                                : ACCUMULATION(0);
+                                    }
+                                }
+                            }
+
+                            for (size_t col_tile = 0; col_tile < cols;
+                                 col_tile += tile_columns)
+                            {
+                                const ACCUMULATION* b = &packed_arg1[col_tile * depth];
+                                for (size_t row_tile = 0; row_tile < rows;
+                                     row_tile += tile_rows)
+                                {
+                                    const ACCUMULATION* a = &packed_arg0[row_tile * depth];
+                                    ACCUMULATION* c = &sums[row_tile * max_cols + col_tile];
+
+                                    ACCUMULATION c_tile[tile_rows][tile_columns];
+                                    for (size_t i = 0; i < tile_rows; ++i)
+                                    {
+                                        for (size_t j = 0; j < tile_columns; ++j)
+                                        {
+                                            c_tile[i][j] = c[i * max_cols + j];
+                                        }
+                                    }
+                                    for (size_t p = 0; p < depth; ++p)
+                                    {
+                                        for (size_t i = 0; i < tile_rows; ++i)
+                                        {
+                                            ACCUMULATION a_ip = a[p * tile_rows + i];
+                                            for (size_t j = 0; j < tile_columns; ++j)
+                                            {
+                                                c_tile[i][j] =
+                                                    c_tile[i][j] +
+                                                    a_ip * b[p * tile_columns + j];
+                                            }
+                                        }
+                                    }
+                                    for (size_t i = 0; i < tile_rows; ++i)
+                                    {
+                                        for (size_t j = 0; j < tile_columns; ++j)
+                                        {
+                                            c[i * max_cols + j] = c_tile[i][j];
+                                        }
+                                    }
+                                }
+                            }
+                        }
+
+                        for (size_t i = 0; i < rows; ++i)
+                        {
+                            OUTPUT* out_row = out + (row0 + i) * n + col0;
+                            const ACCUMULATION* sum_row = &sums[i * max_cols];
+                            for (size_t j = 0; j < cols; ++j)
+                            {
+                                out_row[j] = finish(sum_row[j]);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,219 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+#include "ngraph/axis_set.hpp"
+#include "ngraph/check.hpp"
+#include "ngraph/shape.hpp"
+#include "ngraph/strides.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace reference
+        {
+            /// \brief Strides that walk a tensor of shape \p shape while iterating over a
+            ///        space of rank \p rank, numpy style.
+            ///
+            /// The shape is aligned with the trailing axes of the space. The missing leading
+            /// axes and the axes of length one get a stride of zero, so the tensor is
+            /// broadcast along them.
+            inline Strides broadcast_strides(const Shape& shape, size_t rank)
+            {
+                NGRAPH_CHECK(shape.size() <= rank);
+                Strides strides(rank, 0);
+                size_t stride = 1;
+                for (size_t i = shape.size(); i-- > 0;)
+                {
+                    if (shape[i] != 1)
+                    {
+                        strides[rank - shape.size() + i] = stride;
+                    }
+                    stride *= shape[i];
+                }
+                return strides;
+            }
+
+            /// \brief Strides of the result of reducing \p shape over \p reduction_axes,
+            ///        spread over the axes of \p shape with a stride of zero on the reduced
+            ///        axes.
+            inline Strides reduction_strides(const Shape& shape, const AxisSet& reduction_axes)
+            {
+                Strides strides(shape.size(), 0);
+                size_t stride = 1;
+                for (size_t i = shape.size(); i-- > 0;)
+                {
+                    if (reduction_axes.count(i) == 0)
+                    {
+                        strides[i] = stride;
+                        stride *= shape[i];
+                    }
+                }
+                return strides;
+            }
+
+            /// \brief Row-major iteration over a shape that steps the element offsets of
+            ///        \p N tensors at once.
+            ///
+            /// Each tensor is described by one stride per axis of the iteration space; a zero
+            /// stride broadcasts the tensor along that axis. Axes of length one are dropped
+            /// and neighbouring axes that are contiguous in every tensor are merged, so the
+            /// common cases become loop nests of rank three or less, which have dedicated
+            /// paths. Iteration never allocates and always visits the elements in the
+            /// row-major order of the original shape.
+            template <size_t N>
+            class LoopNest
+            {
+            public:
+                using Offsets = std::array<size_t, N>;
+
+                LoopNest(const Shape& shape, const std::array<Strides, N>& strides)
+                {
+                    for (size_t k = 0; k < N; ++k)
+                    {
+                        NGRAPH_CHECK(strides[k].size() == shape.size(),
+                                     "LoopNest strides of rank ",
+                                     strides[k].size(),
+                                     " do not match shape ",
+                                     shape);
+                    }
+                    for (size_t axis = 0; axis < shape.size(); ++axis)
+                    {
+                        size_t length = shape[axis];
+                        if (length == 0)
+                        {
+                            m_empty = true;
+                        }
+                        if (length <= 1)
+                        {
+                            continue;
+                        }
+                        Offsets axis_strides;
+                        bool contiguous = !m_lengths.empty();
+                        for (size_t k = 0; k < N; ++k)
+                        {
+                            axis_strides[k] = strides[k][axis];
+                            contiguous = contiguous &&
+                                         m_strides.back()[k] == axis_strides[k] * length;
+                        }
+                        if (contiguous)
+                        {
+                            m_lengths.back() *= length;
+                            m_strides.back() = axis_strides;
+                        }
+                        else
+                        {
+                            m_lengths.push_back(length);
+                            m_strides.push_back(axis_strides);
+                        }
+                    }
+                }
+
+                /// \brief Rank of the loop nest after dropping and merging axes
+                size_t get_rank() const { return m_lengths.size(); }
+                /// \brief Strides of the innermost loop, which are the steps of every run
+                Offsets get_inner_strides() const
+                {
+                    return m_strides.empty() ? Offsets{} : m_strides.back();
+                }
+                /// \brief Call \p f(offsets, count, steps) for every run along the innermost
+                ///        loop, where the run's i-th element is at offsets + i * steps.
+                template <typename F>
+                void for_each_run(F&& f) const
+                {
+                    if (m_empty)
+                    {
+                        return;
+                    }
+                    Offsets offsets{};
+                    switch (m_lengths.size())
+                    {
+                    case 0: f(offsets, size_t(1), offsets); break;
+                    case 1: f(offsets, m_lengths[0], m_strides[0]); break;
+                    case 2:
+                        for (size_t i = 0; i < m_lengths[0]; ++i)
+                        {
+                            f(offsets, m_lengths[1], m_strides[1]);
+                            advance(offsets, m_strides[0]);
+                        }
+                        break;
+                    case 3:
+                        for (size_t i = 0; i < m_lengths[0]; ++i)
+                        {
+                            Offsets inner = offsets;
+                            for (size_t j = 0; j < m_lengths[1]; ++j)
+                            {
+                                f(inner, m_lengths[2], m_strides[2]);
+                                advance(inner, m_strides[1]);
+                            }
+                            advance(offsets, m_strides[0]);
+                        }
+                        break;
+                    default: for_each_run_n(offsets, 0, f); break;
+                    }
+                }
+
+                /// \brief Call \p f(offsets) for every element
+                template <typename F>
+                void for_each(F&& f) const
+                {
+                    for_each_run([&f](Offsets offsets, size_t count, const Offsets& steps) {
+                        for (size_t i = 0; i < count; ++i)
+                        {
+                            f(offsets);
+                            advance(offsets, steps);
+                        }
+                    });
+                }
+
+            private:
+                static void advance(Offsets& offsets, const Offsets& steps)
+                {
+                    for (size_t k = 0; k < N; ++k)
+                    {
+                        offsets[k] += steps[k];
+                    }
+                }
+
+                template <typename F>
+                void for_each_run_n(const Offsets& offsets, size_t axis, F& f) const
+                {
+                    if (axis + 1 == m_lengths.size())
+                    {
+                        f(offsets, m_lengths[axis], m_strides[axis]);
+                        return;
+                    }
+                    Offsets inner = offsets;
+                    for (size_t i = 0; i < m_lengths[axis]; ++i)
+                    {
+                        for_each_run_n(inner, axis + 1, f);
+                        advance(inner, m_strides[axis]);
+                    }
+                }
+
+                std::vector<size_t> m_lengths;
+                std::vector<Offsets> m_strides;
+                bool m_empty = false;
+            };
+        }
+    }
+}
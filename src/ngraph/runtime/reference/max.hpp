@@ -16,10 +16,11 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cmath>
 #include <limits>
 
-#include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/reference/loop_nest.hpp"
 #include "ngraph/shape_util.hpp"
 
 namespace ngraph
@@ -36,26 +37,19 @@ namespace ngraph
                                : std::numeric_limits<T>::min();
 
                 auto out_shape = reduce(in_shape, reduction_axes);
-                CoordinateTransform output_transform(out_shape);
-
-                for (const Coordinate& output_coord : output_transform)
-                {
-                    out[output_transform.index(output_coord)] = minval;
-                }
-
-                CoordinateTransform input_transform(in_shape);
-
-                for (const Coordinate& input_coord : input_transform)
-                {
-                    Coordinate output_coord = reduce(input_coord, reduction_axes);
-
-                    T x = arg[input_transform.index(input_coord)];
-                    T max = out[output_transform.index(output_coord)];
+                std::fill(out, out + shape_size(out_shape), minval);
+
+                LoopNest<2> loops(
+                    in_shape,
+                    {row_major_strides(in_shape), reduction_strides(in_shape, reduction_axes)});
+                loops.for_each([&](const LoopNest<2>::Offsets& offsets) {
+                    T x = arg[offsets[0]];
+                    T max = out[offsets[1]];
                     if (x > max)
                     {
-                        out[output_transform.index(output_coord)] = x;
+                        out[offsets[1]] = x;
                     }
-                }
+                });
             }
         }
     }
@@ -16,11 +16,11 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cmath>
-#include <map>
 #include <vector>
 
-#include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/reference/loop_nest.hpp"
 #include "ngraph/runtime/reference/sum.hpp"
 #include "ngraph/shape_util.hpp"
 #include "ngraph/type/bfloat16.hpp"
@@ -36,37 +36,19 @@ namespace ngraph
             void mean(const T* arg, T* out, const Shape& in_shape, const AxisSet& reduction_axes)
             {
                 auto out_shape = reduce(in_shape, reduction_axes);
-                CoordinateTransform output_transform(out_shape);
-                std::vector<T> cs(shape_size(out_shape));
+                std::vector<T> cs(shape_size(out_shape), T(0));
+                std::fill(out, out + shape_size(out_shape), T(0));
 
-                for (const Coordinate& output_coord : output_transform)
-                {
-                    out[output_transform.index(output_coord)] = 0;
-                    cs[output_transform.index(output_coord)] = 0;
-                }
-
-                CoordinateTransform input_transform(in_shape);
-                std::map<size_t, int> index_to_count_map;
-
-                for (const Coordinate& input_coord : input_transform)
-                {
-                    Coordinate output_coord = reduce(input_coord, reduction_axes);
-
-                    T x = arg[input_transform.index(input_coord)];
-                    T& z = out[output_transform.index(output_coord)];
-                    auto index = output_transform.index(output_coord);
-                    if (index_to_count_map.find(index) == index_to_count_map.end())
-                    {
-                        index_to_count_map[index] = 1;
-                    }
-                    else
-                    {
-                        index_to_count_map[index]++;
-                    }
+                LoopNest<2> loops(
+                    in_shape,
+                    {row_major_strides(in_shape), reduction_strides(in_shape, reduction_axes)});
+                loops.for_each([&](const LoopNest<2>::Offsets& offsets) {
+                    T x = arg[offsets[0]];
+                    T& z = out[offsets[1]];
 
                     if (is_finite(x) && is_finite(z))
                     {
-                        T& c = cs[output_transform.index(output_coord)];
+                        T& c = cs[offsets[1]];
                         T t = z + (x - c);
                         c = (t - z) - (x - c);
                         z = t;
@@ -75,13 +57,17 @@ namespace ngraph
                     {
                         z = z + x;
                     }
-                }
+                });
 
-                for (const Coordinate& output_coord : output_transform)
+                // Every output element is the mean of the same number of input elements
+                int count = 1;
+                for (auto axis : reduction_axes)
+                {
+                    count *= static_cast<int>(in_shape[axis]);
+                }
+                for (size_t i = 0; i < shape_size(out_shape); ++i)
                 {
-                    auto count = index_to_count_map[output_transform.index(output_coord)];
-                    out[output_transform.index(output_coord)] =
-                        out[output_transform.index(output_coord)] / count;
+                    out[i] = out[i] / count;
                 }
             }
         }
@@ -16,9 +16,10 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cmath>
 
-#include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/reference/loop_nest.hpp"
 #include "ngraph/shape_util.hpp"
 
 namespace ngraph
@@ -31,23 +32,14 @@ namespace ngraph
             void product(const T* arg, T* out, const Shape& in_shape, const AxisSet& reduction_axes)
             {
                 auto out_shape = reduce(in_shape, reduction_axes);
-                CoordinateTransform output_transform(out_shape);
-
-                for (const Coordinate& output_coord : output_transform)
-                {
-                    out[output_transform.index(output_coord)] = 1;
-                }
-
-                CoordinateTransform input_transform(in_shape);
-
-                for (const Coordinate& input_coord : input_transform)
-                {
-                    Coordinate output_coord = reduce(input_coord, reduction_axes);
-
-                    size_t output_index = output_transform.index(output_coord);
-
-                    out[output_index] = out[output_index] * arg[input_transform.index(input_coord)];
-                }
+                std::fill(out, out + shape_size(out_shape), T(1));
+
+                LoopNest<2> loops(
+                    in_shape,
+                    {row_major_strides(in_shape), reduction_strides(in_shape, reduction_axes)});
+                loops.for_each([&](const LoopNest<2>::Offsets& offsets) {
+                    out[offsets[1]] = out[offsets[1]] * arg[offsets[0]];
+                });
             }
         }
     }
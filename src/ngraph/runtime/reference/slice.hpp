@@ -19,7 +19,7 @@
 #include <cmath>
 
 #include "ngraph/check.hpp"
-#include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/reference/loop_nest.hpp"
 
 namespace ngraph
 {
@@ -36,22 +36,30 @@ namespace ngraph
                        const Strides& strides,
                        const Shape& out_shape)
             {
-                CoordinateTransform input_transform(arg_shape, lower_bounds, upper_bounds, strides);
-                CoordinateTransform output_transform(out_shape);
+                NGRAPH_CHECK(lower_bounds.size() == arg_shape.size() &&
+                             upper_bounds.size() == arg_shape.size() &&
+                             strides.size() == arg_shape.size());
 
-                CoordinateTransform::Iterator output_it = output_transform.begin();
-
-                NGRAPH_CHECK(shape_size(input_transform.get_target_shape()) ==
-                             shape_size(output_transform.get_target_shape()));
-
-                for (const Coordinate& in_coord : input_transform)
+                Shape slice_shape(arg_shape.size());
+                Strides arg_strides = row_major_strides(arg_shape);
+                Strides slice_strides(arg_shape.size());
+                size_t start = 0;
+                for (size_t i = 0; i < arg_shape.size(); ++i)
                 {
-                    const Coordinate& out_coord = *output_it;
+                    NGRAPH_CHECK(lower_bounds[i] <= upper_bounds[i] &&
+                                 upper_bounds[i] <= arg_shape[i] && strides[i] > 0);
+                    slice_shape[i] =
+                        (upper_bounds[i] - lower_bounds[i] + strides[i] - 1) / strides[i];
+                    slice_strides[i] = arg_strides[i] * strides[i];
+                    start += lower_bounds[i] * arg_strides[i];
+                }
 
-                    out[output_transform.index(out_coord)] = arg[input_transform.index(in_coord)];
+                NGRAPH_CHECK(shape_size(slice_shape) == shape_size(out_shape));
 
-                    ++output_it;
-                }
+                LoopNest<2> loops(slice_shape, {slice_strides, row_major_strides(slice_shape)});
+                loops.for_each([&](const LoopNest<2>::Offsets& offsets) {
+                    out[offsets[1]] = arg[start + offsets[0]];
+                });
             }
         }
     }
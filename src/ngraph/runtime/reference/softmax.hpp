@@ -17,10 +17,13 @@
 #pragma once
 
 #include <cmath>
-#include "ngraph/coordinate_transform.hpp"
-#include "ngraph/runtime/reference/max.hpp"
-#include "ngraph/runtime/reference/sum.hpp"
+#include <type_traits>
+#include <vector>
+
+#include "ngraph/runtime/reference/loop_nest.hpp"
 #include "ngraph/shape_util.hpp"
+#include "ngraph/type/bfloat16.hpp"
+#include "ngraph/type/float16.hpp"
 
 namespace ngraph
 {
@@ -28,33 +31,107 @@ namespace ngraph
     {
         namespace reference
         {
+            /// \brief Shared body of softmax and, when \p log is set, log_softmax.
+            ///
+            /// One pass keeps a running max of each group of elements reduced together, and the
+            /// sum of their exps relative to it, rescaling the sum whenever the max grows. A
+            /// second pass writes the outputs. When the reduced axes are the innermost ones each
+            /// group is a contiguous row that stays in cache for both passes; otherwise the
+            /// maxes and sums of all groups are kept side by side.
             template <typename T>
-            void softmax(const T* arg, T* out, const Shape& shape, const AxisSet& axes)
+            void online_softmax(
+                const T* arg, T* out, const Shape& shape, const AxisSet& axes, bool log)
             {
-                auto temp_shape = reduce(shape, axes);
-                auto temp_elements = shape_size(temp_shape);
-                auto temp_ptr = new T[temp_elements];
-
-                max(arg, temp_ptr, shape, axes);
+                // Half precision and integers are computed in float
+                using Acc =
+                    typename std::conditional<std::is_same<T, double>::value, double, float>::type;
 
-                CoordinateTransform transform(shape);
-                CoordinateTransform temp_transform(temp_shape);
-                for (const Coordinate& coord : transform)
+                bool innermost = true;
+                size_t row_length = 1;
+                for (size_t i = 0; i < axes.size(); i++)
                 {
-                    Coordinate temp_coord = reduce(coord, axes);
-                    out[transform.index(coord)] = std::exp(
-                        arg[transform.index(coord)] - temp_ptr[temp_transform.index(temp_coord)]);
+                    size_t axis = shape.size() - axes.size() + i;
+                    innermost = innermost && axes.count(axis) != 0;
+                    row_length *= innermost ? shape[axis] : 1;
                 }
 
-                sum(out, temp_ptr, shape, axes);
+                if (innermost)
+                {
+                    size_t rows = row_length == 0 ? 0 : shape_size(shape) / row_length;
+                    for (size_t row = 0; row < rows; row++)
+                    {
+                        const T* arg_row = arg + row * row_length;
+                        T* out_row = out + row * row_length;
+                        Acc max = static_cast<Acc>(arg_row[0]);
+                        Acc sum = 1;
+                        for (size_t i = 1; i < row_length; i++)
+                        {
+                            Acc x = static_cast<Acc>(arg_row[i]);
+                            if (x > max)
+                            {
+                                sum = sum * std::exp(max - x) + 1;
+                                max = x;
+                            }
+                            else
+                            {
+                                sum += std::exp(x - max);
+                            }
+                        }
+                        Acc log_sum = log ? std::log(sum) : 0;
+                        for (size_t i = 0; i < row_length; i++)
+                        {
+                            Acc x = static_cast<Acc>(arg_row[i]);
+                            out_row[i] = static_cast<T>(log ? x - max - log_sum
+                                                            : std::exp(x - max) / sum);
+                        }
+                    }
+                    return;
+                }
 
-                for (const Coordinate& coord : transform)
+                size_t groups = shape_size(reduce(shape, axes));
+                std::vector<Acc> maxes(groups);
+                std::vector<Acc> sums(groups, 0);
+                LoopNest<2> loops(shape,
+                                  {row_major_strides(shape), reduction_strides(shape, axes)});
+                loops.for_each([&](const LoopNest<2>::Offsets& offsets) {
+                    Acc x = static_cast<Acc>(arg[offsets[0]]);
+                    Acc& max = maxes[offsets[1]];
+                    Acc& sum = sums[offsets[1]];
+                    if (sum == 0)
+                    {
+                        // First element of the group
+                        max = x;
+                        sum = 1;
+                    }
+                    else if (x > max)
+                    {
+                        sum = sum * std::exp(max - x) + 1;
+                        max = x;
+                    }
+                    else
+                    {
+                        sum += std::exp(x - max);
+                    }
+                });
+                if (log)
                 {
-                    Coordinate temp_coord = reduce(coord, axes);
-                    out[transform.index(coord)] /= temp_ptr[temp_transform.index(temp_coord)];
+                    for (Acc& sum : sums)
+                    {
+                        sum = std::log(sum);
+                    }
                 }
+                loops.for_each([&](const LoopNest<2>::Offsets& offsets) {
+                    Acc x = static_cast<Acc>(arg[offsets[0]]);
+                    Acc max = maxes[offsets[1]];
+                    out[offsets[0]] = static_cast<T>(log ? x - max - sums[offsets[1]]
+                                                         : std::exp(x - max) / sums[offsets[1]]);
+                });
+            }
 
-                delete[] temp_ptr;
+            template <typename T>
+            void softmax(const T* arg, T* out, const Shape& shape, const AxisSet& axes)
+            {
+                online_softmax(arg, out, shape, axes, false);
             }
         }
     }
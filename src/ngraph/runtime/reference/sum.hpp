@@ -16,9 +16,10 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cmath>
 
-#include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/reference/loop_nest.hpp"
 #include "ngraph/shape_util.hpp"
 #include "ngraph/type/bfloat16.hpp"
 #include "ngraph/type/float16.hpp"
@@ -56,27 +57,19 @@ namespace ngraph
             void sum(const T* arg, T* out, const Shape& in_shape, const AxisSet& reduction_axes)
             {
                 auto out_shape = reduce(in_shape, reduction_axes);
-                CoordinateTransform output_transform(out_shape);
-                std::vector<T> cs(shape_size(out_shape));
+                std::vector<T> cs(shape_size(out_shape), T(0));
+                std::fill(out, out + shape_size(out_shape), T(0));
 
-                for (const Coordinate& output_coord : output_transform)
-                {
-                    out[output_transform.index(output_coord)] = 0;
-                    cs[output_transform.index(output_coord)] = 0;
-                }
-
-                CoordinateTransform input_transform(in_shape);
-
-                for (const Coordinate& input_coord : input_transform)
-                {
-                    Coordinate output_coord = reduce(input_coord, reduction_axes);
-
-                    T x = arg[input_transform.index(input_coord)];
-                    T& z = out[output_transform.index(output_coord)];
+                LoopNest<2> loops(
+                    in_shape,
+                    {row_major_strides(in_shape), reduction_strides(in_shape, reduction_axes)});
+                loops.for_each([&](const LoopNest<2>::Offsets& offsets) {
+                    T x = arg[offsets[0]];
+                    T& z = out[offsets[1]];
 
                     if (is_finite(x) && is_finite(z))
                     {
-                        T& c = cs[output_transform.index(output_coord)];
+                        T& c = cs[offsets[1]];
                         T t = z + (x - c);
                         c = (t - z) - (x - c);
                         z = t;
@@ -85,7 +78,7 @@ namespace ngraph
                     {
                         z = z + x;
                     }
-                }
+                });
             }
         }
     }
@@ -0,0 +1,263 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+
+#include "ngraph/check.hpp"
+#include "ngraph/except.hpp"
+#include "ngraph/runtime/task_scheduler.hpp"
+#include "ngraph/util.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+runtime::TaskGraph::TaskGraph(size_t size)
+    : m_successors(size)
+    , m_dependency_count(size, 0)
+{
+}
+
+void runtime::TaskGraph::add_dependency(size_t task, size_t dependency)
+{
+    NGRAPH_CHECK(task < size() && dependency < task,
+                 "Task ",
+                 task,
+                 " can not depend on task ",
+                 dependency);
+    vector<size_t>& successors = m_successors[dependency];
+    if (find(successors.begin(), successors.end(), task) == successors.end())
+    {
+        successors.push_back(task);
+        m_dependency_count[task]++;
+    }
+}
+
+struct runtime::TaskScheduler::Job
+{
+    Job(const TaskGraph& graph, const function<void(size_t)>& task)
+        : m_graph(graph)
+        , m_task(task)
+        , m_waiting(new atomic<size_t>[graph.size()])
+        , m_failed(new atomic<bool>[graph.size()])
+        , m_remaining(graph.size())
+    {
+        for (size_t i = 0; i < graph.size(); ++i)
+        {
+            m_waiting[i] = graph.get_dependency_count(i);
+            m_failed[i] = false;
+        }
+    }
+
+    const TaskGraph& m_graph;
+    const function<void(size_t)>& m_task;
+    // Unfinished dependencies of each task
+    unique_ptr<atomic<size_t>[]> m_waiting;
+    // Set when a dependency of the task threw or was skipped
+    unique_ptr<atomic<bool>[]> m_failed;
+    atomic<size_t> m_remaining;
+    // Guards the exception
+    mutex m_mutex;
+    exception_ptr m_exception;
+    size_t m_exception_task = 0;
+};
+
+runtime::TaskScheduler::TaskScheduler(size_t num_threads)
+{
+    NGRAPH_CHECK(num_threads > 0, "TaskScheduler needs at least one thread");
+    for (size_t i = 0; i < num_threads; ++i)
+    {
+        m_workers.emplace_back(new Worker());
+    }
+    for (size_t i = 0; i < num_threads; ++i)
+    {
+        m_workers[i]->m_thread = thread(&TaskScheduler::worker_loop, this, i);
+    }
+}
+
+shared_ptr<runtime::TaskScheduler> runtime::TaskScheduler::create(const string& config)
+{
+    size_t num_threads = 1;
+    for (const string& entry : split(config, ',', true))
+    {
+        auto equals = entry.find('=');
+        if (equals != string::npos && trim(entry.substr(0, equals)) == "threads")
+        {
+            string value = trim(entry.substr(equals + 1));
+            try
+            {
+                num_threads = parse_string<size_t>(value);
+            }
+            catch (const runtime_error&)
+            {
+                throw ngraph_error("Invalid thread count '" + value + "' in '" + config + "'");
+            }
+        }
+    }
+    return num_threads > 1 ? make_shared<TaskScheduler>(num_threads) : nullptr;
+}
+
+runtime::TaskScheduler::~TaskScheduler()
+{
+    {
+        lock_guard<mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_condition.notify_all();
+    for (auto& worker : m_workers)
+    {
+        worker->m_thread.join();
+    }
+}
+
+void runtime::TaskScheduler::run(const TaskGraph& graph, const function<void(size_t)>& task)
+{
+    if (graph.size() == 0)
+    {
+        return;
+    }
+    Job job(graph, task);
+    size_t index = m_next_queue++ % m_workers.size();
+    for (size_t i = 0; i < graph.size(); ++i)
+    {
+        if (graph.get_dependency_count(i) == 0)
+        {
+            push(index, {&job, i});
+        }
+    }
+
+    // The calling thread works through the queues, starting with the one of its own tasks,
+    // until the job is done
+    while (job.m_remaining > 0)
+    {
+        WorkItem item;
+        if (try_pop(index, item))
+        {
+            execute(index, item);
+            continue;
+        }
+        unique_lock<mutex> lock(m_mutex);
+        m_condition.wait(lock, [this, &job] { return job.m_remaining == 0 || m_queued > 0; });
+    }
+    if (job.m_exception)
+    {
+        rethrow_exception(job.m_exception);
+    }
+}
+
+void runtime::TaskScheduler::push(size_t index, const WorkItem& item)
+{
+    {
+        lock_guard<mutex> lock(m_workers[index]->m_mutex);
+        m_workers[index]->m_queue.push_back(item);
+    }
+    {
+        // Counted under m_mutex so a worker can not miss it between its check and its wait
+        lock_guard<mutex> lock(m_mutex);
+        m_queued++;
+    }
+    m_condition.notify_one();
+}
+
+bool runtime::TaskScheduler::try_pop(size_t index, WorkItem& item)
+{
+    {
+        Worker& own = *m_workers[index];
+        lock_guard<mutex> lock(own.m_mutex);
+        if (!own.m_queue.empty())
+        {
+            item = own.m_queue.back();
+            own.m_queue.pop_back();
+            m_queued--;
+            return true;
+        }
+    }
+    for (size_t i = 1; i < m_workers.size(); ++i)
+    {
+        Worker& victim = *m_workers[(index + i) % m_workers.size()];
+        lock_guard<mutex> lock(victim.m_mutex);
+        if (!victim.m_queue.empty())
+        {
+            item = victim.m_queue.front();
+            victim.m_queue.pop_front();
+            m_queued--;
+            return true;
+        }
+    }
+    return false;
+}
+
+void runtime::TaskScheduler::worker_loop(size_t index)
+{
+    while (true)
+    {
+        WorkItem item;
+        if (try_pop(index, item))
+        {
+            execute(index, item);
+            continue;
+        }
+        unique_lock<mutex> lock(m_mutex);
+        m_condition.wait(lock, [this] { return m_stop || m_queued > 0; });
+        if (m_stop)
+        {
+            return;
+        }
+    }
+}
+
+void runtime::TaskScheduler::execute(size_t index, const WorkItem& item)
+{
+    Job& job = *item.m_job;
+    bool failed = job.m_failed[item.m_task];
+    if (!failed)
+    {
+        try
+        {
+            job.m_task(item.m_task);
+        }
+        catch (...)
+        {
+            failed = true;
+            lock_guard<mutex> lock(job.m_mutex);
+            if (!job.m_exception || item.m_task < job.m_exception_task)
+            {
+                job.m_exception = current_exception();
+                job.m_exception_task = item.m_task;
+            }
+        }
+    }
+
+    for (size_t successor : job.m_graph.get_successors(item.m_task))
+    {
+        if (failed)
+        {
+            job.m_failed[successor] = true;
+        }
+        if (--job.m_waiting[successor] == 0)
+        {
+            push(index, {&job, successor});
+        }
+    }
+
+    // The job may be destroyed as soon as the count reaches zero, so it is not touched after
+    if (--job.m_remaining == 0)
+    {
+        // Notified under m_mutex so the thread running the job can not miss it between its
+        // check and its wait
+        lock_guard<mutex> lock(m_mutex);
+        m_condition.notify_all();
+    }
+}
@@ -0,0 +1,113 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "ngraph/ngraph_visibility.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        class TaskGraph;
+        class TaskScheduler;
+    }
+}
+
+/// \brief Dependencies between the tasks run by \sa TaskScheduler
+///
+/// Tasks are numbered 0..size()-1. A task may only depend on tasks with a lower number, so
+/// numbering the tasks in a topological order of the work is always valid.
+class NGRAPH_API ngraph::runtime::TaskGraph
+{
+public:
+    TaskGraph(size_t size = 0);
+
+    /// \brief Make task \p task wait for task \p dependency. Duplicate edges are ignored.
+    void add_dependency(size_t task, size_t dependency);
+
+    size_t size() const { return m_successors.size(); }
+    const std::vector<size_t>& get_successors(size_t task) const { return m_successors[task]; }
+    size_t get_dependency_count(size_t task) const { return m_dependency_count[task]; }
+private:
+    std::vector<std::vector<size_t>> m_successors;
+    std::vector<size_t> m_dependency_count;
+};
+
+/// \brief Runs a \sa TaskGraph on a pool of worker threads
+///
+/// Each task keeps a count of its unfinished dependencies and is queued when it drops to zero.
+/// Every worker owns a queue: it runs the tasks it readied itself most recently first, and
+/// steals the oldest task of another worker when its own queue is empty. Several graphs may
+/// be run at the same time from different threads.
+class NGRAPH_API ngraph::runtime::TaskScheduler
+{
+public:
+    TaskScheduler(size_t num_threads);
+    TaskScheduler(const TaskScheduler&) = delete;
+    TaskScheduler& operator=(const TaskScheduler&) = delete;
+    ~TaskScheduler();
+
+    /// \brief Create a scheduler for the `threads=<n>` entry of a comma separated backend
+    ///        configuration, such as the `threads=8` of `INTERPRETER:threads=8`
+    /// \return nullptr if the configuration asks for fewer than two threads
+    static std::shared_ptr<TaskScheduler> create(const std::string& config);
+
+    size_t get_num_threads() const { return m_workers.size(); }
+    /// \brief Call \p task for every task in \p graph and wait for all of them to finish
+    ///
+    /// The calling thread runs queued tasks too while it waits.
+    ///
+    /// If tasks throw, the tasks that depend on them are not called and the exception of the
+    /// lowest numbered failed task is rethrown once the graph is done.
+    void run(const TaskGraph& graph, const std::function<void(size_t)>& task);
+
+private:
+    struct Job;
+    struct WorkItem
+    {
+        Job* m_job;
+        size_t m_task;
+    };
+    struct Worker
+    {
+        std::mutex m_mutex;
+        std::deque<WorkItem> m_queue;
+        std::thread m_thread;
+    };
+
+    void worker_loop(size_t index);
+    bool try_pop(size_t index, WorkItem& item);
+    void push(size_t index, const WorkItem& item);
+    void execute(size_t index, const WorkItem& item);
+
+    std::vector<std::unique_ptr<Worker>> m_workers;
+    std::mutex m_mutex;
+    std::condition_variable m_condition;
+    std::atomic<size_t> m_queued{0};
+    std::atomic<size_t> m_next_queue{0};
+    bool m_stop = false;
+};
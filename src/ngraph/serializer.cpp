@@ -26,6 +26,7 @@
 #include "ngraph/file_util.hpp"
 #include "ngraph/graph_util.hpp"
 #include "ngraph/log.hpp"
+#include "ngraph/model_file.hpp"
 #include "ngraph/ops.hpp"
 #include "ngraph/provenance.hpp"
 #include "ngraph/serializer.hpp"
@@ -296,8 +297,10 @@ protected:
     map<string, Output<Node>> m_goe_alias;
 };
 
-static string
-    serialize(shared_ptr<ngraph::Function> func, size_t indent, bool binary_constant_data);
+static string serialize(shared_ptr<ngraph::Function> func,
+                        size_t indent,
+                        bool binary_constant_data,
+                        bool serialize_output_shapes = false);
 
 static json write_dimension(Dimension d)
 {
@@ -456,10 +459,54 @@ static void serialize_to_cpio(ostream& out, shared_ptr<ngraph::Function> func, s
 }
 #endif
 
-static string serialize(shared_ptr<Function> func, size_t indent, bool binary_constant_data)
+void ngraph::serialize_model_file(const string& path,
+                                  shared_ptr<ngraph::Function> func,
+                                  size_t indent)
+{
+    ofstream out(path, ios_base::binary | ios_base::out);
+    if (!out)
+    {
+        throw ngraph_error("Unable to create model file '" + path + "'");
+    }
+    serialize_model_file(out, func, indent);
+}
+
+static void write_constant_data(model_file::Writer& writer, const NodeVector& nodes)
+{
+    for (auto& node : nodes)
+    {
+        if (auto c = as_type_ptr<op::v0::Constant>(node))
+        {
+            size_t size = static_cast<size_t>(ceil(shape_size(c->get_output_shape(0)) *
+                                                   c->get_output_element_type(0).bitwidth() /
+                                                   8.f));
+            writer.write(c->get_name(), c->get_data_ptr(), size);
+        }
+        else if (auto ti = as_type_ptr<op::v0::TensorIterator>(node))
+        {
+            // The body is serialized as part of the TensorIterator, its constants included
+            write_constant_data(writer, topological_sort(ti->get_body()->get_results()));
+        }
+    }
+}
+
+void ngraph::serialize_model_file(ostream& out, shared_ptr<ngraph::Function> func, size_t indent)
+{
+    string j = ::serialize(func, indent, true);
+    model_file::Writer writer(out);
+    writer.write(func->get_name(), j.data(), j.size());
+    write_constant_data(writer, func->get_ordered_ops());
+    writer.close();
+}
+
+static string serialize(shared_ptr<Function> func,
+                        size_t indent,
+                        bool binary_constant_data,
+                        bool serialize_output_shapes)
 {
     JSONSerializer serializer;
     serializer.set_binary_constant_data(binary_constant_data);
+    serializer.set_serialize_output_shapes(serialize_output_shapes);
     serializer.set_indent(indent);
 
     json j;
@@ -482,36 +529,89 @@ std::string ngraph::serialize(std::shared_ptr<ngraph::Function> func, size_t ind
     return ::serialize(func, indent, false);
 }
 
+std::string ngraph::serialize_with_output_shapes(std::shared_ptr<ngraph::Function> func,
+                                                 size_t indent)
+{
+    return ::serialize(func, indent, false, true);
+}
+
+std::string ngraph::serialize_node_attributes(const Node& node)
+{
+    const NodeTypeInfo& type_info = node.get_type_info();
+    if (get_typeid(string(type_info.name) + "_v" + to_string(type_info.version)) ==
+        OP_TYPEID::UnknownOp)
+    {
+        return "";
+    }
+    JSONSerializer serializer;
+    json j = serializer.serialize_node(node);
+    for (auto key :
+         {"name", "friendly_name", "inputs", "control_deps", "outputs", "provenance_tags"})
+    {
+        j.erase(key);
+    }
+    return j.dump();
+}
+
+static shared_ptr<ngraph::Function> deserialize_model_file(const model_file::Reader& reader)
+{
+    shared_ptr<Function> rc;
+    NGRAPH_CHECK(reader.get_entry_count() > 0, "Model file holds no model");
+    // The first entry is the model
+    const char* text = reader.get_data(0);
+    json js = json::parse(text, text + reader.get_size(0));
+    JSONDeserializer deserializer;
+    deserializer.set_const_data_callback(
+        [&](const string& const_name, const element::Type& et, const Shape& shape) {
+            shared_ptr<Node> const_node;
+            size_t index = reader.find(const_name);
+            if (index < reader.get_entry_count())
+            {
+                const_node = make_shared<op::v0::Constant>(et, shape, reader.get_buffer(index));
+            }
+            return const_node;
+        });
+    for (json func : js)
+    {
+        rc = deserializer.deserialize_function(func);
+    }
+    return rc;
+}
+
 shared_ptr<ngraph::Function> ngraph::deserialize(istream& in)
 {
     shared_ptr<Function> rc;
-    if (cpio::is_cpio(in))
+    if (model_file::is_model_file(in))
+    {
+        model_file::Reader reader(in);
+        rc = deserialize_model_file(reader);
+    }
+    else if (cpio::is_cpio(in))
     {
         cpio::Reader reader(in);
         vector<cpio::FileInfo> file_info = reader.get_file_info();
         if (file_info.size() > 0)
         {
             // The first file is the model
-            uint32_t size = static_cast<uint32_t>(file_info[0].get_size());
-            char* data = new char[size];
-            reader.read(file_info[0].get_name(), data, size);
-            string jstr(data, size);
-            delete[] data;
+            string jstr(file_info[0].get_size(), '\0');
+            reader.read(file_info[0], &jstr[0]);
             json js = json::parse(jstr);
+            unordered_map<string, const cpio::FileInfo*> file_index;
+            for (const cpio::FileInfo& info : file_info)
+            {
+                file_index.emplace(info.get_name(), &info);
+            }
             JSONDeserializer deserializer;
             deserializer.set_const_data_callback(
                 [&](const string& const_name, const element::Type& et, const Shape& shape) {
                     shared_ptr<Node> const_node;
-                    for (const cpio::FileInfo& info : file_info)
+                    auto it = file_index.find(const_name);
+                    if (it != file_index.end())
                     {
-                        if (info.get_name() == const_name)
-                        {
-                            void* const_data = ngraph_malloc(info.get_size());
-                            reader.read(const_name, const_data, info.get_size());
-                            const_node = make_shared<op::v0::Constant>(et, shape, const_data);
-                            ngraph_free(const_data);
-                            break;
-                        }
+                        const cpio::FileInfo& info = *it->second;
+                        auto const_data = make_shared<runtime::AlignedBuffer>(info.get_size());
+                        reader.read(info, const_data->get_ptr());
+                        const_node = make_shared<op::v0::Constant>(et, shape, const_data);
                     }
                     return const_node;
                 });
@@ -537,6 +637,11 @@ shared_ptr<ngraph::Function> ngraph::deserialize(const string& s)
     if (file_util::exists(s))
     {
         // s is a file and not a json string
+        if (model_file::is_model_file(s))
+        {
+            // Map the file so the constants reference its pages rather than copies
+            return deserialize_model_file(model_file::Reader(s));
+        }
         ifstream in(s, ios_base::binary | ios_base::in);
         rc = deserialize(in);
     }
@@ -894,6 +999,18 @@ shared_ptr<Node> JSONDeserializer::deserialize_node(json node_js)
                     }
                 }
                 node->constructor_validate_and_infer_types();
+                if (has_key(node_js, "output_types"))
+                {
+                    // Ops that infer their output types in their constructor rely on the types
+                    // recorded at serialization time
+                    vector<json> output_types = node_js.at("output_types");
+                    for (size_t i = 0; i < output_types.size(); ++i)
+                    {
+                        node->set_output_type(i,
+                                              read_element_type(output_types[i].at("element_type")),
+                                              read_partial_shape(output_types[i].at("shape")));
+                    }
+                }
                 m_node_map[node_name] = node;
                 return node;
             }
@@ -1097,9 +1214,17 @@ shared_ptr<Node> JSONDeserializer::deserialize_node(json node_js)
             auto type_node_js =
                 has_key(node_js, "element_type") ? node_js : node_js.at("value_type");
             auto element_type = read_element_type(type_node_js.at("element_type"));
-            auto shape = type_node_js.at("shape");
-            auto value = node_js.at("value").get<vector<string>>();
-            node = make_shared<op::v0::Constant>(element_type, shape, value);
+            Shape shape = type_node_js.at("shape");
+            if (!has_key(node_js, "value") && m_const_data_callback)
+            {
+                node = m_const_data_callback(node_name, element_type, shape);
+                NGRAPH_CHECK(node, "No data found for constant ", node_name);
+            }
+            else
+            {
+                auto value = node_js.at("value").get<vector<string>>();
+                node = make_shared<op::v0::Constant>(element_type, shape, value);
+            }
             break;
         }
         case OP_TYPEID::Convert_v0:
@@ -2494,17 +2619,23 @@ shared_ptr<Node> JSONDeserializer::deserialize_node(json node_js)
             {
                 body_nodes.push_back(deserialize_node(jnode));
             }
+            // Parameters and results used by the body are already in the body nodes
+            auto deserialize_body_node = [&](json jnode) {
+                auto it = m_node_map.find(jnode.at("name").get<string>());
+                return it != m_node_map.end() ? it->second : deserialize_node(jnode);
+            };
             json jparams = jbody["parameters"];
             ParameterVector parameters;
             for (json jparam : jparams)
             {
-                parameters.push_back(as_type_ptr<op::v0::Parameter>(deserialize_node(jparam)));
+                parameters.push_back(
+                    as_type_ptr<op::v0::Parameter>(deserialize_body_node(jparam)));
             }
             json jresults = jbody["results"];
             ResultVector results;
             for (json jresult : jresults)
             {
-                results.push_back(as_type_ptr<op::v0::Result>(deserialize_node(jresult)));
+                results.push_back(as_type_ptr<op::v0::Result>(deserialize_body_node(jresult)));
             }
             ti->set_body(make_shared<op::v0::TensorIterator::BodyLambda>(results, parameters));
             json jins = node_js["input_descriptions"];
@@ -2703,6 +2834,18 @@ json JSONSerializer::serialize_node(const Node& n)
     {
         node["outputs"] = outputs;
     }
+    if (m_serialize_output_shapes)
+    {
+        json output_types = json::array();
+        for (auto& output : n.outputs())
+        {
+            json output_type;
+            output_type["element_type"] = write_element_type(output.get_element_type());
+            output_type["shape"] = write_partial_shape(output.get_partial_shape());
+            output_types.push_back(output_type);
+        }
+        node["output_types"] = output_types;
+    }
 
     if (ngraph::get_provenance_enabled())
     {
@@ -2852,8 +2995,12 @@ json JSONSerializer::serialize_node(const Node& n)
     case OP_TYPEID::Constant_v0:
     {
         auto tmp = static_cast<const op::v0::Constant*>(&n);
-        if (tmp->get_all_data_elements_bitwise_identical() &&
-            shape_size(tmp->get_output_shape(0)) > 0)
+        if (m_binary_constant_data)
+        {
+            // The data is stored next to the json, under the name of the node
+        }
+        else if (tmp->get_all_data_elements_bitwise_identical() &&
+                 shape_size(tmp->get_output_shape(0)) > 0)
         {
             vector<string> vs;
             vs.push_back(tmp->convert_value_to_string(0));
@@ -31,6 +31,18 @@ namespace ngraph
     NGRAPH_API
     std::string serialize(std::shared_ptr<ngraph::Function> func, size_t indent = 0);
 
+    /// \brief Serialize a Function to a json string, recording the element type and shape of
+    ///    every node output.
+    ///
+    /// Deserializing the result restores the recorded output types on ops that are constructed
+    /// through their attribute visitor, so ops that infer their types in their constructor, such as
+    /// backend-specific fused ops, can be saved after backend passes have run.
+    /// \param func The Function to serialize
+    /// \param indent See serialize(std::shared_ptr<ngraph::Function>, size_t)
+    NGRAPH_API
+    std::string serialize_with_output_shapes(std::shared_ptr<ngraph::Function> func,
+                                             size_t indent = 0);
+
     /// \brief Serialize a Function to a json file
     /// \param path The path to the output file
     /// \param func The Function to serialize
@@ -51,6 +63,35 @@ namespace ngraph
     NGRAPH_API
     void serialize(std::ostream& out, std::shared_ptr<ngraph::Function> func, size_t indent = 0);
 
+    /// \brief Serialize the attributes of a node, leaving out its name and its connections
+    ///    to other nodes
+    /// \param node The node to serialize
+    /// \return The attributes as a json string, or an empty string if the serializer does not
+    ///    know the node's op or is disabled in the build
+    NGRAPH_API
+    std::string serialize_node_attributes(const Node& node);
+
+    /// \brief Serialize a Function to a model file
+    ///
+    /// The data of the constants is stored in binary, aligned so that deserializing the file
+    /// from its path memory maps it and the constants reference the mapped data directly.
+    /// \param path The path to the output file
+    /// \param func The Function to serialize
+    /// \param indent See serialize(std::shared_ptr<ngraph::Function>, size_t)
+    NGRAPH_API
+    void serialize_model_file(const std::string& path,
+                              std::shared_ptr<ngraph::Function> func,
+                              size_t indent = 0);
+
+    /// \brief Serialize a Function to a model file stream
+    /// \param out The output stream to which the data is serialized.
+    /// \param func The Function to serialize
+    /// \param indent See serialize(std::shared_ptr<ngraph::Function>, size_t)
+    NGRAPH_API
+    void serialize_model_file(std::ostream& out,
+                              std::shared_ptr<ngraph::Function> func,
+                              size_t indent = 0);
+
     /// \brief Deserialize a Function
     /// \param in An isteam to the input data
     NGRAPH_API
@@ -33,6 +33,25 @@ void ngraph::serialize(std::ostream& out, std::shared_ptr<ngraph::Function> func
     throw std::runtime_error("serializer disabled in build");
 }
 
+std::string ngraph::serialize_node_attributes(const ngraph::Node& node)
+{
+    return "";
+}
+
+void ngraph::serialize_model_file(const std::string& path,
+                                  std::shared_ptr<ngraph::Function> func,
+                                  size_t indent)
+{
+    throw std::runtime_error("serializer disabled in build");
+}
+
+void ngraph::serialize_model_file(std::ostream& out,
+                                  std::shared_ptr<ngraph::Function> func,
+                                  size_t indent)
+{
+    throw std::runtime_error("serializer disabled in build");
+}
+
 std::shared_ptr<ngraph::Function> ngraph::deserialize(std::istream& in)
 {
     throw std::runtime_error("serializer disabled in build");
@@ -32,6 +32,7 @@
 //==============================================================================
 
 #include <cmath>
+#include <cstring>
 #include <iostream>
 #include <limits>
 
@@ -49,19 +50,41 @@ bool float_isnan(const float& x)
 
 std::vector<float> bfloat16::to_float_vector(const std::vector<bfloat16>& v_bf16)
 {
-    std::vector<float> v_f32(v_bf16.begin(), v_bf16.end());
+    std::vector<float> v_f32(v_bf16.size());
+    to_float(v_bf16.data(), v_f32.data(), v_bf16.size());
     return v_f32;
 }
 
 std::vector<bfloat16> bfloat16::from_float_vector(const std::vector<float>& v_f32)
 {
-    std::vector<bfloat16> v_bf16;
-    v_bf16.reserve(v_f32.size());
-    for (float a : v_f32)
+    std::vector<bfloat16> v_bf16(v_f32.size());
+    from_float(v_f32.data(), v_bf16.data(), v_f32.size());
+    return v_bf16;
+}
+
+// The loops below only move bits around so the compiler can vectorize them
+void bfloat16::to_float(const bfloat16* src, float* dst, size_t count)
+{
+    for (size_t i = 0; i < count; ++i)
     {
-        v_bf16.push_back(static_cast<bfloat16>(a));
+        uint32_t bits = static_cast<uint32_t>(src[i].m_value) << 16;
+        memcpy(&dst[i], &bits, sizeof(bits));
+    }
+}
+
+void bfloat16::from_float(const float* src, bfloat16* dst, size_t count)
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        uint32_t bits;
+        memcpy(&bits, &src[i], sizeof(bits));
+#if defined ROUND_MODE_TO_NEAREST
+        bits += 0x8000;
+#elif defined ROUND_MODE_TO_NEAREST_EVEN
+        bits += (bits & 0x00010000) >> 1;
+#endif
+        dst[i].m_value = static_cast<uint16_t>(bits >> 16);
     }
-    return v_bf16;
 }
 
 std::string bfloat16::to_string() const
@@ -63,8 +63,35 @@ namespace ngraph
         bool operator>=(const bfloat16& other) const;
         operator float() const;
 
+        // Arithmetic is done in float and rounded back, as if by bfloat16(float)
+        bfloat16 operator-() const { return from_bits(m_value ^ 0x8000); }
+        template <typename T>
+        bfloat16& operator+=(const T& other)
+        {
+            return *this = bfloat16(static_cast<float>(*this) + static_cast<float>(other));
+        }
+        template <typename T>
+        bfloat16& operator-=(const T& other)
+        {
+            return *this = bfloat16(static_cast<float>(*this) - static_cast<float>(other));
+        }
+        template <typename T>
+        bfloat16& operator*=(const T& other)
+        {
+            return *this = bfloat16(static_cast<float>(*this) * static_cast<float>(other));
+        }
+        template <typename T>
+        bfloat16& operator/=(const T& other)
+        {
+            return *this = bfloat16(static_cast<float>(*this) / static_cast<float>(other));
+        }
+
         static std::vector<float> to_float_vector(const std::vector<bfloat16>&);
         static std::vector<bfloat16> from_float_vector(const std::vector<float>&);
+        /// \brief Convert an array to float without constructing a value for every element
+        static void to_float(const bfloat16* src, float* dst, size_t count);
+        /// \brief Convert an array from float, rounding like bfloat16(float)
+        static void from_float(const float* src, bfloat16* dst, size_t count);
         static constexpr bfloat16 from_bits(uint16_t bits) { return bfloat16(bits, true); }
         uint16_t to_bits() const;
         friend std::ostream& operator<<(std::ostream& out, const bfloat16& obj)
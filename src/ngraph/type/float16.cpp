@@ -32,6 +32,7 @@
 //==============================================================================
 
 #include <cmath>
+#include <cstring>
 #include <iostream>
 #include <limits>
 
@@ -42,14 +43,10 @@ using namespace ngraph;
 
 static_assert(sizeof(float16) == 2, "class float16 must be exactly 2 bytes");
 
-float16::float16(float value)
+// Both conversions are inline so that the array versions below do not make a call per element
+static inline uint16_t float_bits_to_half_bits(uint32_t iv)
 {
     // Work in 32-bit and shift right 16 in the end
-    union {
-        float fv;
-        uint32_t iv;
-    };
-    fv = value;
     // sign
     constexpr uint32_t smask = 0x80000000;
     // floqt32 exp
@@ -84,13 +81,11 @@ float16::float16(float value)
                 frac = 0x00010000;
             }
         }
-        m_value = ((iv & smask) | emask_16 | frac) >> 16;
-        return;
+        return static_cast<uint16_t>(((iv & smask) | emask_16 | frac) >> 16);
     }
     if (biased_exp_field_32 == 0)
     {
-        m_value = (iv & smask) >> 16;
-        return;
+        return static_cast<uint16_t>((iv & smask) >> 16);
     }
     int16_t biased_exp_16 = (biased_exp_field_32 >> 23) - 127 + 15;
     // In the normalized_16 realm
@@ -107,13 +102,11 @@ float16::float16(float value)
     if (biased_exp_16 > 30)
     {
         // Infinity
-        m_value = ((iv & smask) | emask_16 | 0) >> 16;
-        return;
+        return static_cast<uint16_t>(((iv & smask) | emask_16 | 0) >> 16);
     }
     if (biased_exp_16 > 0)
     {
-        m_value = ((iv & smask) | biased_exp_16 << 26 | frac) >> 16;
-        return;
+        return static_cast<uint16_t>(((iv & smask) | biased_exp_16 << 26 | frac) >> 16);
     }
     // Restore the hidden 1
     frac = 0x04000000 | ((iv & fmask_32) << 3);
@@ -125,7 +118,14 @@ float16::float16(float value)
     {
         frac += reven_16;
     }
-    m_value = ((iv & smask) | frac) >> 16;
+    return static_cast<uint16_t>(((iv & smask) | frac) >> 16);
+}
+
+float16::float16(float value)
+{
+    uint32_t iv;
+    memcpy(&iv, &value, sizeof(iv));
+    m_value = float_bits_to_half_bits(iv);
 }
 
 std::string float16::to_string() const
@@ -170,15 +170,11 @@ bool float16::operator>=(const float16& other) const
     return (static_cast<float>(*this) >= static_cast<float>(other));
 }
 
-float16::operator float() const
+static inline uint32_t half_bits_to_float_bits(uint16_t bits)
 {
-    union {
-        uint32_t i_val;
-        float f_val;
-    };
-    uint32_t exp = 0x1F & (m_value >> frac_size);
+    uint32_t exp = 0x1F & (bits >> float16::frac_size);
     uint32_t fexp = exp + 127 - 15;
-    uint32_t frac = m_value & 0x03FF;
+    uint32_t frac = bits & 0x03FF;
     if (exp == 0)
     {
         if (frac == 0)
@@ -201,9 +197,35 @@ float16::operator float() const
     {
         fexp = 0xFF;
     }
-    frac = frac << (23 - frac_size);
-    i_val = static_cast<uint32_t>((m_value & 0x8000)) << 16 | (fexp << 23) | frac;
-    return f_val;
+    frac = frac << (23 - float16::frac_size);
+    return static_cast<uint32_t>((bits & 0x8000)) << 16 | (fexp << 23) | frac;
+}
+
+float16::operator float() const
+{
+    uint32_t bits = half_bits_to_float_bits(m_value);
+    float value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+void float16::to_float(const float16* src, float* dst, size_t count)
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        uint32_t bits = half_bits_to_float_bits(src[i].m_value);
+        memcpy(&dst[i], &bits, sizeof(bits));
+    }
+}
+
+void float16::from_float(const float* src, float16* dst, size_t count)
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        uint32_t bits;
+        memcpy(&bits, &src[i], sizeof(bits));
+        dst[i].m_value = float_bits_to_half_bits(bits);
+    }
 }
 
 bool std::isnan(float16 x)
@@ -58,6 +58,33 @@ namespace ngraph
         bool operator>=(const float16& other) const;
         operator float() const;
 
+        // Arithmetic is done in float and rounded back, as if by float16(float)
+        float16 operator-() const { return from_bits(m_value ^ 0x8000); }
+        template <typename T>
+        float16& operator+=(const T& other)
+        {
+            return *this = float16(static_cast<float>(*this) + static_cast<float>(other));
+        }
+        template <typename T>
+        float16& operator-=(const T& other)
+        {
+            return *this = float16(static_cast<float>(*this) - static_cast<float>(other));
+        }
+        template <typename T>
+        float16& operator*=(const T& other)
+        {
+            return *this = float16(static_cast<float>(*this) * static_cast<float>(other));
+        }
+        template <typename T>
+        float16& operator/=(const T& other)
+        {
+            return *this = float16(static_cast<float>(*this) / static_cast<float>(other));
+        }
+
+        /// \brief Convert an array to float without constructing a value for every element
+        static void to_float(const float16* src, float* dst, size_t count);
+        /// \brief Convert an array from float, rounding like float16(float)
+        static void from_float(const float* src, float16* dst, size_t count);
         static constexpr float16 from_bits(uint16_t bits) { return float16(bits, true); }
         uint16_t to_bits() const;
         friend std::ostream& operator<<(std::ostream& out, const float16& obj)
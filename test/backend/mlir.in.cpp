@@ -17,11 +17,14 @@
 // End to end test for MLIR. Add tests here that are specific to test MLIR functionality
 // MLIR is implicitly tested during other unit-tests as well.
 
+#include <llvm/Support/CommandLine.h>
+
 #include "gtest/gtest.h"
 #include "ngraph/ngraph.hpp"
 #include "util/all_close.hpp"
 #include "util/all_close_f.hpp"
 #include "util/ndarray.hpp"
+#include "util/random.hpp"
 #include "util/test_control.hpp"
 #include "util/test_tools.hpp"
 
@@ -30,6 +33,38 @@ using namespace ngraph;
 
 static string s_manifest = "${MANIFEST}";
 
+namespace
+{
+    /// \brief Turns on a boolean MLIR command line option, such as
+    ///        -ngraph-affine-loop-parallel, until it is destroyed. Options of backends that
+    ///        are not loaded are left alone.
+    class MLIROptionEnabler
+    {
+    public:
+        MLIROptionEnabler(const string& name)
+        {
+            auto option = llvm::cl::getRegisteredOptions().lookup(name);
+            if (option)
+            {
+                m_option = static_cast<llvm::cl::opt<bool>*>(option);
+                m_saved_value = *m_option;
+                *m_option = true;
+            }
+        }
+        ~MLIROptionEnabler()
+        {
+            if (m_option)
+            {
+                *m_option = m_saved_value;
+            }
+        }
+
+    private:
+        llvm::cl::opt<bool>* m_option = nullptr;
+        bool m_saved_value = false;
+    };
+}
+
 // Combined ops test
 NGRAPH_TEST(${BACKEND_NAME}, mlir_dot_add)
 {
@@ -281,3 +316,38 @@ NGRAPH_TEST(${BACKEND_NAME}, mlir_multi_call)
     EXPECT_TRUE(test::all_close_f(read_vector<float>(result),
                                   vector<float>{35.f, 40.f, 45.f, 68.f, 82.f, 96.f}));
 }
+
+// The outlined parallel loops run on the thread pool of the execution context
+NGRAPH_TEST(${BACKEND_NAME}, mlir_parallel_vectorized_loops)
+{
+    auto make_function = []() {
+        auto A = make_shared<op::v0::Parameter>(element::f32, Shape{64, 96});
+        auto B = make_shared<op::v0::Parameter>(element::f32, Shape{96, 80});
+        auto C = make_shared<op::v0::Parameter>(element::f32, Shape{64, 80});
+        auto dot = make_shared<op::v0::Dot>(A, B);
+        auto add = make_shared<op::v1::Add>(dot, C);
+        return make_shared<Function>(make_shared<op::v1::Add>(add, add),
+                                     ParameterVector{A, B, C});
+    };
+
+    // The options are registered when the backend library is loaded
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    MLIROptionEnabler parallel("ngraph-affine-loop-parallel");
+    MLIROptionEnabler vectorize("ngraph-affine-vectorize");
+
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<vector<float>> args;
+    for (auto& param : make_function()->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_output_shape(0)));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+    auto expected = execute(make_function(), args, "INTERPRETER");
+    // Twice, so that the second call runs the kernel cached by the first
+    for (size_t call = 0; call < 2; ++call)
+    {
+        auto result = execute(make_function(), args, "${BACKEND_NAME}");
+        EXPECT_TRUE(test::all_close_f(expected.at(0), result.at(0)));
+    }
+}
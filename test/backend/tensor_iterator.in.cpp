@@ -0,0 +1,126 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "gtest/gtest.h"
+#include "ngraph/ngraph.hpp"
+#include "util/all_close_f.hpp"
+#include "util/test_control.hpp"
+#include "util/test_tools.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static string s_manifest = "${MANIFEST}";
+
+NGRAPH_TEST(${BACKEND_NAME}, tensor_iterator_cumulative_sum)
+{
+    // Parts of X along axis 1 are not contiguous, so they are copied in and out of the body
+    auto X = make_shared<op::v0::Parameter>(element::f32, Shape{2, 3, 2});
+    auto H_init = make_shared<op::v0::Parameter>(element::f32, Shape{2, 1, 2});
+
+    auto Xi = make_shared<op::v0::Parameter>(element::f32, Shape{2, 1, 2});
+    auto H = make_shared<op::v0::Parameter>(element::f32, Shape{2, 1, 2});
+    auto H_o = make_shared<op::v1::Add>(H, Xi);
+    auto body = make_shared<op::v0::TensorIterator::BodyLambda>(OutputVector{H_o},
+                                                                ParameterVector{Xi, H});
+
+    auto tensor_iterator = make_shared<op::v0::TensorIterator>();
+    tensor_iterator->set_body(body);
+    tensor_iterator->set_sliced_input(Xi, X, 0, 1, 1, -1, 1);
+    tensor_iterator->set_merged_input(H, H_init, H_o);
+    auto sums = tensor_iterator->get_concatenated_slices(H_o, 0, 1, 1, -1, 1);
+    auto total = tensor_iterator->get_iter_value(H_o, -1);
+    auto f = make_shared<Function>(OutputVector{sums, total}, ParameterVector{X, H_init});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    auto x = backend->create_tensor(element::f32, Shape{2, 3, 2});
+    copy_data(x, vector<float>{1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12});
+    auto h_init = backend->create_tensor(element::f32, Shape{2, 1, 2});
+    copy_data(h_init, vector<float>{0, 0, 100, 100});
+    auto result_sums = backend->create_tensor(element::f32, Shape{2, 3, 2});
+    auto result_total = backend->create_tensor(element::f32, Shape{2, 1, 2});
+
+    auto handle = backend->compile(f);
+    handle->call_with_validate({result_sums, result_total}, {x, h_init});
+    EXPECT_TRUE(test::all_close_f(
+        (vector<float>{1, 2, 4, 6, 9, 12, 107, 108, 116, 118, 127, 130}),
+        read_vector<float>(result_sums),
+        MIN_FLOAT_TOLERANCE_BITS));
+    EXPECT_TRUE(test::all_close_f((vector<float>{9, 12, 127, 130}),
+                                  read_vector<float>(result_total),
+                                  MIN_FLOAT_TOLERANCE_BITS));
+
+    // The merged input starts over from its initial value on every call
+    handle->call_with_validate({result_sums, result_total}, {x, h_init});
+    EXPECT_TRUE(test::all_close_f((vector<float>{9, 12, 127, 130}),
+                                  read_vector<float>(result_total),
+                                  MIN_FLOAT_TOLERANCE_BITS));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, tensor_iterator_reversed_slices)
+{
+    // Parts of X along axis 0 are contiguous and read in place, from the last to the first
+    auto X = make_shared<op::v0::Parameter>(element::f32, Shape{3, 2});
+    auto H_init = make_shared<op::v0::Parameter>(element::f32, Shape{1, 2});
+    auto W = make_shared<op::v0::Parameter>(element::f32, Shape{1, 2});
+
+    auto Xi = make_shared<op::v0::Parameter>(element::f32, Shape{1, 2});
+    auto H = make_shared<op::v0::Parameter>(element::f32, Shape{1, 2});
+    auto W_body = make_shared<op::v0::Parameter>(element::f32, Shape{1, 2});
+    auto H_o = make_shared<op::v1::Add>(H, make_shared<op::v1::Multiply>(Xi, W_body));
+    auto body = make_shared<op::v0::TensorIterator::BodyLambda>(
+        OutputVector{H_o}, ParameterVector{Xi, H, W_body});
+
+    auto tensor_iterator = make_shared<op::v0::TensorIterator>();
+    tensor_iterator->set_body(body);
+    tensor_iterator->set_sliced_input(Xi, X, -1, -1, 1, 0, 0);
+    tensor_iterator->set_merged_input(H, H_init, H_o);
+    tensor_iterator->set_invariant_input(W_body, W);
+    auto forward = tensor_iterator->get_concatenated_slices(H_o, 0, 1, 1, -1, 0);
+    auto backward = tensor_iterator->get_concatenated_slices(H_o, -1, -1, 1, 0, 0);
+    auto first = tensor_iterator->get_iter_value(H_o, 0);
+    auto last = tensor_iterator->get_iter_value(H_o, -1);
+    auto f = make_shared<Function>(OutputVector{forward, backward, first, last},
+                                   ParameterVector{X, H_init, W});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    auto x = backend->create_tensor(element::f32, Shape{3, 2});
+    copy_data(x, vector<float>{1, 2, 3, 4, 5, 6});
+    auto h_init = backend->create_tensor(element::f32, Shape{1, 2});
+    copy_data(h_init, vector<float>{0, 0});
+    auto w = backend->create_tensor(element::f32, Shape{1, 2});
+    copy_data(w, vector<float>{1, 10});
+    auto result_forward = backend->create_tensor(element::f32, Shape{3, 2});
+    auto result_backward = backend->create_tensor(element::f32, Shape{3, 2});
+    auto result_first = backend->create_tensor(element::f32, Shape{1, 2});
+    auto result_last = backend->create_tensor(element::f32, Shape{1, 2});
+
+    auto handle = backend->compile(f);
+    handle->call_with_validate({result_forward, result_backward, result_first, result_last},
+                               {x, h_init, w});
+    EXPECT_TRUE(test::all_close_f((vector<float>{5, 60, 8, 100, 9, 120}),
+                                  read_vector<float>(result_forward),
+                                  MIN_FLOAT_TOLERANCE_BITS));
+    EXPECT_TRUE(test::all_close_f((vector<float>{9, 120, 8, 100, 5, 60}),
+                                  read_vector<float>(result_backward),
+                                  MIN_FLOAT_TOLERANCE_BITS));
+    EXPECT_TRUE(test::all_close_f(
+        (vector<float>{5, 60}), read_vector<float>(result_first), MIN_FLOAT_TOLERANCE_BITS));
+    EXPECT_TRUE(test::all_close_f(
+        (vector<float>{9, 120}), read_vector<float>(result_last), MIN_FLOAT_TOLERANCE_BITS));
+}
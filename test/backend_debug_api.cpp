@@ -17,6 +17,7 @@
 #include <random>
 #include <sstream>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "gtest/gtest.h"
@@ -74,3 +75,157 @@ TEST(INTERPRETER, nan_check_output)
     ihandle->set_nan_check(true);
     EXPECT_ANY_THROW(handle->call_with_validate({result}, {a, b}));
 }
+
+TEST(INTERPRETER, memory_pool_reuse_across_calls)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto B = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto C = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto t0 = make_shared<op::v1::Add>(A, B);
+    auto t1 = make_shared<op::v1::Multiply>(t0, C);
+    auto t2 = make_shared<op::v1::Subtract>(t1, A);
+    auto f = make_shared<Function>(OutputVector{t2, t0}, ParameterVector{A, B, C});
+
+    shared_ptr<runtime::Backend> backend = runtime::Backend::create("INTERPRETER");
+    shared_ptr<runtime::Executable> handle = backend->compile(f);
+
+    auto a = backend->create_tensor(element::f32, shape);
+    auto b = backend->create_tensor(element::f32, shape);
+    auto c = backend->create_tensor(element::f32, shape);
+    auto r0 = backend->create_tensor(element::f32, shape);
+    auto r1 = backend->create_tensor(element::f32, shape);
+
+    copy_data(a, vector<float>{1, 2, 3, 4});
+    copy_data(b, vector<float>{5, 6, 7, 8});
+    copy_data(c, vector<float>{2, 2, 2, 2});
+    handle->call_with_validate({r0, r1}, {a, b, c});
+    EXPECT_EQ((vector<float>{11, 14, 17, 20}), read_vector<float>(r0));
+    EXPECT_EQ((vector<float>{6, 8, 10, 12}), read_vector<float>(r1));
+
+    copy_data(c, vector<float>{0, 1, 0, 1});
+    handle->call_with_validate({r0, r1}, {a, b, c});
+    EXPECT_EQ((vector<float>{-1, 6, -3, 8}), read_vector<float>(r0));
+    EXPECT_EQ((vector<float>{6, 8, 10, 12}), read_vector<float>(r1));
+}
+
+TEST(INTERPRETER, parallel_call_matches_sequential)
+{
+    Shape shape{3, 4};
+    auto A = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto B = make_shared<op::v0::Parameter>(element::f32, shape);
+    // Independent branches that join at the end
+    OutputVector branches;
+    for (size_t i = 0; i < 8; ++i)
+    {
+        auto c = op::v0::Constant::create(element::f32, shape, vector<float>(12, i + 1.0f));
+        auto t0 = make_shared<op::v1::Multiply>(A, c);
+        auto t1 = make_shared<op::v1::Subtract>(t0, B);
+        branches.push_back(make_shared<op::v0::Tanh>(t1));
+    }
+    Output<Node> sum = branches[0];
+    for (size_t i = 1; i < branches.size(); ++i)
+    {
+        sum = make_shared<op::v1::Add>(sum, branches[i]);
+    }
+    auto f = make_shared<Function>(OutputVector{sum, branches[3]}, ParameterVector{A, B});
+
+    auto sequential = runtime::Backend::create("INTERPRETER");
+    auto parallel = runtime::Backend::create("INTERPRETER:threads=4");
+    auto sequential_handle = sequential->compile(f);
+    auto parallel_handle = parallel->compile(f);
+
+    auto a = sequential->create_tensor(element::f32, shape);
+    auto b = sequential->create_tensor(element::f32, shape);
+    auto expected0 = sequential->create_tensor(element::f32, shape);
+    auto expected1 = sequential->create_tensor(element::f32, shape);
+    auto result0 = parallel->create_tensor(element::f32, shape);
+    auto result1 = parallel->create_tensor(element::f32, shape);
+    for (size_t call = 0; call < 10; ++call)
+    {
+        vector<float> a_data(12);
+        vector<float> b_data(12);
+        for (size_t i = 0; i < 12; ++i)
+        {
+            a_data[i] = 0.01f * (i + call);
+            b_data[i] = 0.02f * i - 0.1f * call;
+        }
+        copy_data(a, a_data);
+        copy_data(b, b_data);
+        sequential_handle->call_with_validate({expected0, expected1}, {a, b});
+        parallel_handle->call_with_validate({result0, result1}, {a, b});
+        EXPECT_EQ(read_vector<float>(expected0), read_vector<float>(result0));
+        EXPECT_EQ(read_vector<float>(expected1), read_vector<float>(result1));
+    }
+}
+
+TEST(INTERPRETER, concurrent_calls_keep_their_intermediates)
+{
+    Shape shape{16};
+    auto A = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto B = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto t0 = make_shared<op::v1::Add>(A, B);
+    auto t1 = make_shared<op::v1::Multiply>(t0, A);
+    auto t2 = make_shared<op::v1::Subtract>(t1, B);
+    auto f = make_shared<Function>(OutputVector{t2}, ParameterVector{A, B});
+
+    for (string config : {"INTERPRETER", "INTERPRETER:threads=2"})
+    {
+        auto backend = runtime::Backend::create(config);
+        auto handle = backend->compile(f);
+        // Every thread checks its own results, so calls that shared the pool would mix up
+        // each other's intermediates
+        vector<size_t> failures(4);
+        vector<thread> threads;
+        for (size_t t = 0; t < failures.size(); ++t)
+        {
+            threads.emplace_back([&, t]() {
+                auto a = backend->create_tensor(element::f32, shape);
+                auto b = backend->create_tensor(element::f32, shape);
+                auto result = backend->create_tensor(element::f32, shape);
+                for (size_t call = 0; call < 200; ++call)
+                {
+                    float x = static_cast<float>(t * 1000 + call);
+                    copy_data(a, vector<float>(16, x));
+                    copy_data(b, vector<float>(16, 1.0f));
+                    handle->call_with_validate({result}, {a, b});
+                    if (read_vector<float>(result) != vector<float>(16, (x + 1) * x - 1))
+                    {
+                        ++failures[t];
+                    }
+                }
+            });
+        }
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+        EXPECT_EQ(failures, vector<size_t>(failures.size(), 0)) << config;
+    }
+}
+
+TEST(INTERPRETER, half_precision_dot)
+{
+    Shape shape_a{2, 3};
+    Shape shape_b{3, 2};
+    for (element::Type type : {element::f16, element::bf16})
+    {
+        auto A = make_shared<op::v0::Parameter>(element::f32, shape_a);
+        auto B = make_shared<op::v0::Parameter>(element::f32, shape_b);
+        auto dot = make_shared<op::v0::Dot>(make_shared<op::v0::Convert>(A, type),
+                                            make_shared<op::v0::Convert>(B, type));
+        auto relu = make_shared<op::v0::Relu>(dot);
+        auto f = make_shared<Function>(make_shared<op::v0::Convert>(relu, element::f32),
+                                       ParameterVector{A, B});
+
+        auto backend = runtime::Backend::create("INTERPRETER");
+        auto a = backend->create_tensor(element::f32, shape_a);
+        auto b = backend->create_tensor(element::f32, shape_b);
+        auto result = backend->create_tensor(element::f32, Shape{2, 2});
+        copy_data(a, vector<float>{1, 2, 3, 4, 5, 6});
+        copy_data(b, vector<float>{1, -2, 0.5f, -4, 0.25f, -6});
+        auto handle = backend->compile(f);
+        handle->call_with_validate({result}, {a, b});
+        EXPECT_EQ((vector<float>{2.75f, 0, 8, 0}), read_vector<float>(result));
+    }
+}
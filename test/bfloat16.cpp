@@ -225,6 +225,17 @@ TEST(benchmark, bfloat16)
         NGRAPH_INFO << "float to bfloat16 round to nearest even " << timer.get_milliseconds()
                     << "ms";
     }
+
+    {
+        ngraph::runtime::AlignedBuffer bf_data(buffer_size * sizeof(bfloat16), 4096);
+        bfloat16* p = static_cast<bfloat16*>(bf_data.get_ptr());
+        stopwatch timer;
+        timer.start();
+        bfloat16::from_float(f, p, buffer_size);
+        timer.stop();
+        NGRAPH_INFO << "float to bfloat16 from_float            " << timer.get_milliseconds()
+                    << "ms";
+    }
 }
 
 TEST(bfloat16, assigns)
@@ -239,3 +239,40 @@ TEST(build_graph, default_output_checks)
         FAIL() << "nullptr initialization of Output failed";
     }
 }
+
+TEST(build_graph, ordered_ops_cache)
+{
+    auto A = make_shared<op::v0::Parameter>(element::f32, Shape{2});
+    auto B = make_shared<op::v0::Parameter>(element::f32, Shape{2});
+    auto add = make_shared<op::v1::Add>(A, B);
+    auto neg = make_shared<op::v0::Negative>(add);
+    auto f = make_shared<Function>(OutputVector{neg}, ParameterVector{A, B});
+
+    auto ordered = f->get_ordered_ops();
+    EXPECT_EQ(ordered, topological_sort(NodeVector{f->get_results().at(0), A, B}));
+    EXPECT_EQ(ordered, f->get_ordered_ops());
+
+    // Rewiring an input is seen by the next call
+    auto mul = make_shared<op::v1::Multiply>(A, B);
+    neg->input(0).replace_source_output(mul);
+    ordered = f->get_ordered_ops();
+    EXPECT_EQ(find(ordered.begin(), ordered.end(), add), ordered.end());
+    EXPECT_LT(find(ordered.begin(), ordered.end(), mul), find(ordered.begin(), ordered.end(), neg));
+    // The cache does not keep the node that was cut out alive
+    weak_ptr<Node> weak_add = add;
+    add.reset();
+    EXPECT_TRUE(weak_add.expired());
+
+    // So is a new control dependency
+    auto sub = make_shared<op::v1::Subtract>(A, B);
+    neg->add_control_dependency(sub);
+    ordered = f->get_ordered_ops();
+    EXPECT_LT(find(ordered.begin(), ordered.end(), sub), find(ordered.begin(), ordered.end(), neg));
+
+    // And a replaced parameter
+    auto C = make_shared<op::v0::Parameter>(element::f32, Shape{2});
+    f->replace_parameter(1, C);
+    ordered = f->get_ordered_ops();
+    EXPECT_EQ(find(ordered.begin(), ordered.end(), B), ordered.end());
+    EXPECT_EQ(ordered, topological_sort(NodeVector{f->get_results().at(0), A, C}));
+}
@@ -0,0 +1,174 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <atomic>
+#include <fstream>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "ngraph/chrome_trace.hpp"
+#include "ngraph/file_util.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+// Returns the events of the trace at path, which are one per line
+static vector<string> read_trace(const string& path)
+{
+    ifstream in(path);
+    vector<string> events;
+    string line;
+    getline(in, line);
+    EXPECT_EQ(line, "[");
+    while (getline(in, line) && line != "]")
+    {
+        if (!line.empty() && line.back() == ',')
+        {
+            line.pop_back();
+        }
+        events.push_back(line);
+    }
+    EXPECT_EQ(line, "]");
+    return events;
+}
+
+static void record_durations(size_t count)
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        event::Duration duration("op", "chrome_trace_test");
+    }
+}
+
+TEST(chrome_trace, concurrent_durations)
+{
+    string path = file_util::tmp_filename(".json");
+    event::Manager::open(path);
+    event::Manager::enable_event_tracing();
+
+    const size_t thread_count = 4;
+    const size_t duration_count = 1000;
+    vector<thread> threads;
+    for (size_t i = 0; i < thread_count; ++i)
+    {
+        threads.emplace_back(record_durations, duration_count);
+    }
+    for (auto& t : threads)
+    {
+        t.join();
+    }
+    event::Manager::disable_event_tracing();
+    event::Manager::close();
+
+    set<string> thread_ids;
+    size_t durations = 0;
+    for (const string& e : read_trace(path))
+    {
+        if (e.find(R"("name":"op","cat":"chrome_trace_test","ph":"X")") != string::npos)
+        {
+            ++durations;
+            size_t tid = e.find(R"("tid":)");
+            thread_ids.insert(e.substr(tid, e.find(',', tid) - tid));
+        }
+    }
+    EXPECT_EQ(durations, thread_count * duration_count);
+    EXPECT_EQ(thread_ids.size(), thread_count);
+    file_util::remove_file(path);
+}
+
+TEST(chrome_trace, threads_exiting_during_flush)
+{
+    string path = file_util::tmp_filename(".json");
+    event::Manager::open(path);
+    event::Manager::enable_event_tracing();
+
+    // Short lived threads, flushed while they push and exit
+    atomic<bool> recording{true};
+    thread flusher([&recording] {
+        while (recording)
+        {
+            event::Manager::flush();
+        }
+    });
+    const size_t thread_count = 200;
+    const size_t duration_count = 50;
+    for (size_t i = 0; i < thread_count; i += 4)
+    {
+        vector<thread> threads;
+        for (size_t j = 0; j < 4; ++j)
+        {
+            threads.emplace_back(record_durations, duration_count);
+        }
+        for (auto& t : threads)
+        {
+            t.join();
+        }
+    }
+    recording = false;
+    flusher.join();
+    event::Manager::disable_event_tracing();
+    event::Manager::close();
+
+    size_t durations = 0;
+    for (const string& e : read_trace(path))
+    {
+        if (e.find(R"("name":"op","cat":"chrome_trace_test","ph":"X")") != string::npos)
+        {
+            ++durations;
+        }
+    }
+    EXPECT_EQ(durations, thread_count * duration_count);
+    file_util::remove_file(path);
+}
+
+TEST(chrome_trace, sampled_durations)
+{
+    string path = file_util::tmp_filename(".json");
+    event::Manager::open(path);
+    event::Manager::enable_event_tracing();
+    event::Manager::set_sampling_interval(10);
+
+    thread(record_durations, 1000).join();
+    event::Manager::set_sampling_interval(1);
+    {
+        event::Duration duration(string(100, 'x'), "chrome_trace_test", R"({"key":1})");
+    }
+    event::Manager::disable_event_tracing();
+    event::Manager::close();
+
+    size_t durations = 0;
+    size_t truncated = 0;
+    for (const string& e : read_trace(path))
+    {
+        if (e.find(R"("name":"op")") != string::npos)
+        {
+            ++durations;
+        }
+        if (e.find(R"("name":")" + string(event::Record::name_size - 1, 'x') + '"') !=
+                string::npos &&
+            e.find(R"("args":{"key":1})") != string::npos)
+        {
+            ++truncated;
+        }
+    }
+    EXPECT_EQ(durations, 100);
+    EXPECT_EQ(truncated, 1);
+    file_util::remove_file(path);
+}
@@ -19,6 +19,7 @@
 #include <gtest/gtest.h>
 
 #include "ngraph/ngraph.hpp"
+#include "ngraph/runtime/shared_buffer.hpp"
 #include "util/type_prop.hpp"
 
 using namespace ngraph;
@@ -1022,6 +1023,33 @@ TEST(constant, shared_data)
     EXPECT_EQ(p1, p2);
 }
 
+TEST(constant, external_data)
+{
+    auto storage = make_shared<vector<float>>(vector<float>{1, 2, 3, 4, 5, 6});
+    auto buffer = make_shared<runtime::SharedBuffer<shared_ptr<vector<float>>>>(
+        reinterpret_cast<char*>(storage->data()), storage->size() * sizeof(float), storage);
+    const float* data = storage->data();
+    storage.reset();
+
+    auto c = make_shared<op::v0::Constant>(element::f32, Shape{2, 3}, buffer);
+    buffer.reset();
+    EXPECT_EQ(c->get_data_ptr<float>(), data);
+    EXPECT_EQ(c->get_vector<float>(), (vector<float>{1, 2, 3, 4, 5, 6}));
+
+    // Clones of a function share the storage of its constants
+    auto f = make_shared<Function>(c, ParameterVector{});
+    auto g = clone_function(*f);
+    auto c2 = as_type_ptr<op::v0::Constant>(g->get_results()[0]->get_argument(0));
+    ASSERT_NE(c2, nullptr);
+    EXPECT_EQ(c2->get_data_ptr<float>(), data);
+}
+
+TEST(constant, external_data_too_small)
+{
+    auto buffer = make_shared<runtime::AlignedBuffer>(4 * sizeof(float));
+    EXPECT_THROW(make_shared<op::v0::Constant>(element::f32, Shape{2, 3}, buffer), CheckFailure);
+}
+
 template <typename T1, typename T2>
 ::testing::AssertionResult test_convert()
 {
@@ -600,3 +600,45 @@ TEST(batch_fusion, pass_property)
     ASSERT_TRUE(pass->get_property(pass::PassProperty::REQUIRE_STATIC_SHAPE));
     ASSERT_FALSE(pass->get_property(pass::PassProperty::CHANGE_DYNAMIC_STATE));
 }
+
+TEST(core_fusion, DISABLED_benchmark_graph_rewrite_models)
+{
+    vector<string> models;
+    file_util::iterate_files(SERIALIZED_ZOO,
+                             [&models](const string& file, bool is_dir) {
+                                 if (!is_dir && file_util::get_file_ext(file) == ".json")
+                                 {
+                                     models.push_back(file);
+                                 }
+                             },
+                             true);
+    sort(models.begin(), models.end());
+
+    constexpr size_t num_iterations = 10;
+    size_t total_nanosec = 0;
+    for (const string& model : models)
+    {
+        const string json_string = file_util::read_file_to_string(model);
+        size_t node_count = 0;
+        size_t nanosec = 0;
+        for (size_t i = 0; i < num_iterations; i++)
+        {
+            shared_ptr<Function> f = deserialize(json_string);
+            node_count = f->get_ops().size();
+            pass::Manager pass_manager;
+            pass_manager.register_pass<pass::CoreFusion>();
+
+            stopwatch sw;
+            sw.start();
+            pass_manager.run_passes(f);
+            sw.stop();
+            nanosec += sw.get_nanoseconds();
+        }
+        total_nanosec += nanosec;
+        std::cout << model << " (" << node_count << " nodes): " << nanosec / num_iterations
+                  << " ns" << std::endl;
+    }
+
+    std::cout << "CoreFusion over " << models.size()
+              << " models: " << total_nanosec / num_iterations << " ns" << std::endl;
+}
@@ -0,0 +1,43 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <cstdint>
+
+#include "gtest/gtest.h"
+
+#include "ngraph/runtime/cpu/cpu_op_counters.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+TEST(cpu_op_counters, latency_histogram)
+{
+    using Histogram = runtime::cpu::OpLatencyHistogram;
+    for (size_t b = 0; b + 1 < Histogram::bucket_count; b++)
+    {
+        EXPECT_EQ(Histogram::get_bucket(Histogram::get_lower_bound(b)), b);
+        EXPECT_EQ(Histogram::get_bucket(Histogram::get_lower_bound(b + 1) - 1), b);
+    }
+    EXPECT_EQ(Histogram::get_bucket(uint64_t(1) << 40), Histogram::bucket_count - 1);
+
+    Histogram histogram;
+    histogram.m_counts[Histogram::get_bucket(1000)] = 99;
+    histogram.m_counts[Histogram::get_bucket(100000)] = 1;
+    EXPECT_EQ(histogram.get_count(), 100);
+    EXPECT_NEAR(histogram.get_percentile(0.5), 1000, 125);
+    EXPECT_NEAR(histogram.get_percentile(0.99), 1000, 125);
+    EXPECT_NEAR(histogram.get_percentile(1.0), 100000, 12500);
+}
@@ -0,0 +1,166 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "ngraph/check.hpp"
+#include "ngraph/runtime/cpu/cpu_op_graph.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+TEST(cpu_op_graph, priorities_follow_longest_path)
+{
+    // 0 -> 1 -> 3 and 0 -> 2 -> 3
+    runtime::cpu::OpGraph graph({{}, {0}, {0}, {1, 2}}, {1, 5, 2, 1});
+    EXPECT_EQ(graph.size(), 4);
+    EXPECT_EQ(graph.get_priorities(), (vector<uint64_t>{7, 6, 3, 1}));
+
+    graph.update_priorities({1, 1, 10, 1});
+    EXPECT_EQ(graph.get_priorities(), (vector<uint64_t>{12, 2, 11, 1}));
+}
+
+TEST(cpu_op_graph, predecessors_must_come_first)
+{
+    EXPECT_THROW(runtime::cpu::OpGraph({{1}, {}}, {1, 1}), CheckFailure);
+    EXPECT_THROW(runtime::cpu::OpGraph({{}, {}}, {1}), CheckFailure);
+}
+
+#if defined(NGRAPH_TBB_ENABLE)
+// Random graph where every functor waits for up to three earlier ones
+static vector<vector<size_t>> make_random_predecessors(size_t size, unsigned seed)
+{
+    mt19937 engine(seed);
+    vector<vector<size_t>> predecessors(size);
+    for (size_t i = 1; i < size; i++)
+    {
+        uniform_int_distribution<size_t> distribution(0, i - 1);
+        for (size_t j = 0; j < 3; j++)
+        {
+            size_t predecessor = distribution(engine);
+            if (find(predecessors[i].begin(), predecessors[i].end(), predecessor) ==
+                predecessors[i].end())
+            {
+                predecessors[i].push_back(predecessor);
+            }
+        }
+    }
+    return predecessors;
+}
+
+// Runs the graph and checks every functor ran once, after all of its predecessors
+static bool run_checked(const runtime::cpu::OpGraph& graph,
+                        const vector<vector<size_t>>& predecessors)
+{
+    unique_ptr<atomic<size_t>[]> pending(new atomic<size_t>[graph.size()]);
+    unique_ptr<atomic<int>[]> runs(new atomic<int>[graph.size()]);
+    for (size_t i = 0; i < graph.size(); i++)
+    {
+        runs[i].store(0);
+    }
+    atomic<bool> in_order{true};
+    graph.run(pending.get(), [&](size_t index, int) {
+        for (size_t predecessor : predecessors[index])
+        {
+            if (runs[predecessor].load() != 1)
+            {
+                in_order.store(false);
+            }
+        }
+        runs[index].fetch_add(1);
+    });
+    bool passed = in_order.load();
+    for (size_t i = 0; i < graph.size(); i++)
+    {
+        passed = passed && runs[i].load() == 1;
+    }
+    return passed;
+}
+
+TEST(cpu_op_graph, runs_each_functor_after_its_predecessors)
+{
+    for (unsigned seed = 0; seed < 20; seed++)
+    {
+        auto predecessors = make_random_predecessors(200, seed);
+        runtime::cpu::OpGraph graph(predecessors, vector<uint64_t>(predecessors.size(), 1));
+        // The counters are reset by every call
+        EXPECT_TRUE(run_checked(graph, predecessors));
+        EXPECT_TRUE(run_checked(graph, predecessors));
+    }
+}
+
+TEST(cpu_op_graph, concurrent_runs)
+{
+    auto predecessors = make_random_predecessors(500, 7);
+    runtime::cpu::OpGraph graph(predecessors, vector<uint64_t>(predecessors.size(), 1));
+
+    const size_t num_threads = 4;
+    // char rather than bool so that every thread writes a byte of its own
+    vector<char> passed(num_threads, false);
+    vector<thread> threads;
+    for (size_t t = 0; t < num_threads; t++)
+    {
+        threads.emplace_back([&, t]() {
+            bool all_passed = true;
+            for (size_t call = 0; call < 20; call++)
+            {
+                all_passed = run_checked(graph, predecessors) && all_passed;
+            }
+            passed[t] = all_passed;
+        });
+    }
+    for (auto& t : threads)
+    {
+        t.join();
+    }
+    for (size_t t = 0; t < num_threads; t++)
+    {
+        EXPECT_TRUE(passed[t]) << "thread " << t;
+    }
+}
+
+TEST(cpu_op_graph, longest_branch_starts_on_the_calling_thread)
+{
+    // Three independent chains: 0 -> 3, 1 -> 4 and 2 -> 5, the middle one the most costly
+    vector<vector<size_t>> predecessors{{}, {}, {}, {0}, {1}, {2}};
+    runtime::cpu::OpGraph graph(predecessors, {1, 1, 1, 1, 100, 1});
+
+    unique_ptr<atomic<size_t>[]> pending(new atomic<size_t>[graph.size()]);
+    vector<int> arenas(graph.size(), -1);
+    vector<thread::id> threads(graph.size());
+    graph.run(pending.get(), [&](size_t index, int arena) {
+        arenas[index] = arena;
+        threads[index] = this_thread::get_id();
+    });
+    EXPECT_EQ(arenas[1], 0);
+    EXPECT_EQ(threads[1], this_thread::get_id());
+    // A chain keeps its arena and the others get arenas of their own
+    EXPECT_EQ(arenas[4], 0);
+    EXPECT_EQ(arenas[0], arenas[3]);
+    EXPECT_EQ(arenas[2], arenas[5]);
+    EXPECT_NE(arenas[0], 0);
+    EXPECT_NE(arenas[2], 0);
+    EXPECT_NE(arenas[0], arenas[2]);
+}
+#endif
@@ -16,9 +16,13 @@
 
 #include <algorithm>
 #include <cstdio>
+#include <fstream>
+#include <future>
 #include <iostream>
 #include <list>
 #include <memory>
+#include <set>
+#include <sstream>
 #include <thread>
 
 #include "gtest/gtest.h"
@@ -39,6 +43,8 @@
 #include "ngraph/pass/visualize_tree.hpp"
 #include "ngraph/runtime/cpu/cpu_backend.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/cpu_call_frame.hpp"
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
 #include "ngraph/runtime/cpu/cpu_tensor.hpp"
 #include "ngraph/runtime/cpu/dnnl_utils.hpp"
 #include "ngraph/runtime/cpu/op/convert_layout.hpp"
@@ -49,6 +55,7 @@
 #include "util/all_close_f.hpp"
 #include "util/autodiff/backprop_function.hpp"
 #include "util/autodiff/numeric_compare.hpp"
+#include "util/environment_guard.hpp"
 #include "util/float_util.hpp"
 #include "util/ndarray.hpp"
 #include "util/random.hpp"
@@ -184,6 +191,168 @@ NGRAPH_TEST(${BACKEND_NAME}, cpu_test_abc_tbb)
         unset_environment("NGRAPH_CPU_USE_TBB");
     }
 }
+
+NGRAPH_TEST(${BACKEND_NAME}, cpu_test_diamond_tbb)
+{
+    bool use_tbb = getenv_bool("NGRAPH_CPU_USE_TBB");
+    if (!use_tbb)
+    {
+        set_environment("NGRAPH_CPU_USE_TBB", "1", 1);
+    }
+
+    // Two independent branches that join, and an op that only depends on a parameter
+    Shape shape{2, 2};
+    auto A = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto B = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto left = make_shared<op::v1::Add>(A, B);
+    auto right = make_shared<op::v1::Multiply>(A, B);
+    auto join = make_shared<op::v1::Subtract>(right, left);
+    auto neg = make_shared<op::v0::Negative>(B);
+    auto f = make_shared<Function>(NodeVector{join, neg}, ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    shared_ptr<runtime::Tensor> a = backend->create_tensor(element::f32, shape);
+    shared_ptr<runtime::Tensor> b = backend->create_tensor(element::f32, shape);
+    shared_ptr<runtime::Tensor> r0 = backend->create_tensor(element::f32, shape);
+    shared_ptr<runtime::Tensor> r1 = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{1, 2, 3, 4});
+    copy_data(b, vector<float>{5, 6, 7, 8});
+
+    auto handle = backend->compile(f);
+    for (size_t i = 0; i < 3; i++)
+    {
+        handle->call_with_validate({r0, r1}, {a, b});
+        EXPECT_TRUE(test::all_close_f(read_vector<float>(r0), vector<float>{-1, 4, 11, 20}));
+        EXPECT_TRUE(test::all_close_f(read_vector<float>(r1), vector<float>{-5, -6, -7, -8}));
+    }
+    handle->call_with_validate({r0, r1}, {b, a});
+    EXPECT_TRUE(test::all_close_f(read_vector<float>(r0), vector<float>{-1, 4, 11, 20}));
+    EXPECT_TRUE(test::all_close_f(read_vector<float>(r1), vector<float>{-1, -2, -3, -4}));
+
+    if (!use_tbb)
+    {
+        unset_environment("NGRAPH_CPU_USE_TBB");
+    }
+}
+
+// A long branch of dots next to a short elementwise one, run on two thread pools for enough
+// calls that the ops get prioritized by their measured latencies
+static void run_uneven_branches_tbb(const string& backend_name)
+{
+    ASSERT_EQ(runtime::cpu::executor::GetCPUExecutor().get_num_thread_pools(), 2);
+
+    Shape shape{32, 32};
+    auto A = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto B = make_shared<op::v0::Parameter>(element::f32, shape);
+    shared_ptr<Node> chain = A;
+    for (size_t i = 0; i < 4; i++)
+    {
+        chain = make_shared<op::v0::Dot>(chain, B);
+    }
+    auto f = make_shared<Function>(make_shared<op::v1::Add>(chain, make_shared<op::v0::Abs>(B)),
+                                   ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create(backend_name);
+    auto int_backend = runtime::Backend::create("INTERPRETER");
+    test::Uniform<float> rng(-0.5f, 0.5f);
+    vector<shared_ptr<runtime::Tensor>> cpu_args;
+    vector<shared_ptr<runtime::Tensor>> int_args;
+    for (auto& param : f->get_parameters())
+    {
+        auto arg = rng.initialize(vector<float>(shape_size(param->get_shape())));
+        cpu_args.push_back(backend->create_tensor(element::f32, param->get_shape()));
+        int_args.push_back(int_backend->create_tensor(element::f32, param->get_shape()));
+        copy_data(cpu_args.back(), arg);
+        copy_data(int_args.back(), arg);
+    }
+    auto cpu_result = backend->create_tensor(element::f32, shape);
+    auto int_result = int_backend->create_tensor(element::f32, shape);
+    int_backend->compile(f)->call_with_validate({int_result}, int_args);
+
+    auto handle = backend->compile(f);
+    auto cpu_handle = dynamic_pointer_cast<runtime::cpu::CPU_Executable>(handle);
+    // Every op of the dot chain is on the critical path, ahead of the Abs and of the Add the
+    // two branches join in, and the chain ranks its ops from the first to the last
+    auto check_priorities = [&]() {
+        vector<runtime::cpu::OpStats> stats = cpu_handle->get_op_stats();
+        vector<uint64_t> priorities = cpu_handle->get_op_priorities();
+        ASSERT_EQ(priorities.size(), stats.size());
+        vector<uint64_t> chain_priorities;
+        uint64_t abs_priority = 0;
+        uint64_t add_priority = 0;
+        for (size_t i = 0; i < stats.size(); i++)
+        {
+            string op = stats[i].m_node->description();
+            if (op == "Dot" || op == "MatmulBias")
+            {
+                chain_priorities.push_back(priorities[i]);
+            }
+            else if (op == "Abs")
+            {
+                abs_priority = priorities[i];
+            }
+            else if (op == "Add")
+            {
+                add_priority = priorities[i];
+            }
+        }
+        ASSERT_EQ(chain_priorities.size(), 4);
+        for (size_t i = 0; i < chain_priorities.size(); i++)
+        {
+            EXPECT_GT(chain_priorities[i], abs_priority);
+            EXPECT_GT(chain_priorities[i], add_priority);
+            if (i > 0)
+            {
+                EXPECT_GT(chain_priorities[i - 1], chain_priorities[i]);
+            }
+        }
+        EXPECT_GT(abs_priority, add_priority);
+    };
+    check_priorities();
+    for (size_t i = 0; i < 20; i++)
+    {
+        handle->call_with_validate({cpu_result}, cpu_args);
+        EXPECT_TRUE(test::all_close(read_vector<float>(cpu_result),
+                                    read_vector<float>(int_result),
+                                    1.0e-3f,
+                                    1.0e-3f));
+    }
+    check_priorities();
+}
+
+// Sets the style of the death tests until it is destroyed
+class DeathTestStyleGuard
+{
+public:
+    DeathTestStyleGuard(const string& style)
+        : m_saved_style(::testing::FLAGS_gtest_death_test_style)
+    {
+        ::testing::FLAGS_gtest_death_test_style = style;
+    }
+    ~DeathTestStyleGuard() { ::testing::FLAGS_gtest_death_test_style = m_saved_style; }
+    DeathTestStyleGuard(const DeathTestStyleGuard&) = delete;
+    DeathTestStyleGuard& operator=(const DeathTestStyleGuard&) = delete;
+
+private:
+    string m_saved_style;
+};
+
+NGRAPH_TEST(${BACKEND_NAME}, cpu_test_uneven_branches_tbb)
+{
+    // The thread pools are made once per process, so the test runs in a new process that has
+    // NGRAPH_INTER_OP_PARALLELISM set before it makes them. The flags and variables are
+    // restored when the test ends, so they do not change the tests after it.
+    DeathTestStyleGuard death_test_style("threadsafe");
+    test::EnvironmentGuard use_tbb("NGRAPH_CPU_USE_TBB", "1");
+    test::EnvironmentGuard inter_op_parallelism("NGRAPH_INTER_OP_PARALLELISM", "2");
+    EXPECT_EXIT(
+        {
+            run_uneven_branches_tbb("${BACKEND_NAME}");
+            exit(::testing::Test::HasFailure() ? 1 : 0);
+        },
+        ::testing::ExitedWithCode(0),
+        "");
+}
 #endif // NGRAPH_TBB_ENABLE
 
 NGRAPH_TEST(${BACKEND_NAME}, cpu_test_dnnl_layouts)
@@ -1077,6 +1246,53 @@ NGRAPH_TEST(${BACKEND_NAME}, cpu_test_constant_convertlayout)
     ASSERT_EQ(convert_layout, 1);
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, cpu_test_constant_convertlayout_padded)
+{
+    // Three output channels do not fill a block of the weights layout DNNL picks, so the
+    // prepacked weights are padded
+    Shape data_shape{1, 16, 8, 8};
+    Shape weights_shape{3, 16, 3, 3};
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<float> weights_values(shape_size(weights_shape));
+    rng.initialize(weights_values);
+    auto make_function = [&]() {
+        auto data = make_shared<op::v0::Parameter>(element::f32, data_shape);
+        auto weights = make_shared<op::v0::Constant>(element::f32, weights_shape, weights_values);
+        auto conv = make_shared<op::v0::Convolution>(data, weights, Strides{1, 1}, Strides{1, 1});
+        return make_shared<Function>(OutputVector{make_shared<op::v0::Relu>(conv)},
+                                     ParameterVector{data});
+    };
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto cpu_f = make_function();
+    auto handle = backend->compile(cpu_f);
+    // The weights are reordered at compile time rather than on the first call of every context
+    for (auto& node : cpu_f->get_ops())
+    {
+        if (is_type<runtime::cpu::op::ConvertLayout>(node))
+        {
+            EXPECT_FALSE(is_type<op::v0::Constant>(node->get_input_node_shared_ptr(0)));
+        }
+    }
+    compare_backends(
+        make_function(), make_function(), "INTERPRETER", "${BACKEND_NAME}", 1e-4, 1e-4);
+
+    // Saving keeps the padded weights
+    stringstream saved;
+    handle->save(saved);
+    auto loaded = backend->load(saved);
+    ASSERT_NE(loaded, nullptr);
+    vector<float> data_values(shape_size(data_shape));
+    rng.initialize(data_values);
+    auto data = backend->create_tensor(element::f32, data_shape);
+    copy_data(data, data_values);
+    auto expected = backend->create_tensor(element::f32, Shape{1, 3, 6, 6});
+    auto result = backend->create_tensor(element::f32, Shape{1, 3, 6, 6});
+    handle->call_with_validate({expected}, {data});
+    loaded->call_with_validate({result}, {data});
+    EXPECT_EQ(read_vector<float>(expected), read_vector<float>(result));
+}
+
 NGRAPH_TEST(${BACKEND_NAME}, cpu_test_constant_reshape)
 {
     // Initialize CPU constant folders
@@ -2320,3 +2536,394 @@ NGRAPH_TEST(${BACKEND_NAME}, cpu_test_one_hot_scalar_oob_in_3)
     handle->call_with_validate({result}, {a});
     EXPECT_EQ(r_data[3], 0);
 }
+
+NGRAPH_TEST(${BACKEND_NAME}, cpu_test_shared_context_memory)
+{
+    test::EnvironmentGuard environment_guard("NGRAPH_CPU_SHARED_CONTEXT_MEMORY", "1");
+
+    Shape shape{2, 2};
+    auto A = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto B = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto sum = make_shared<op::v1::Add>(A, B);
+    auto f = make_shared<Function>(make_shared<op::v1::Multiply>(sum, sum), ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto a = backend->create_tensor(element::f32, shape);
+    auto b = backend->create_tensor(element::f32, shape);
+    auto result = backend->create_tensor(element::f32, shape);
+
+    auto handle = backend->compile(f);
+    auto cpu_handle = dynamic_pointer_cast<runtime::cpu::CPU_Executable>(handle);
+    for (float scale : {1.0f, 2.0f})
+    {
+        copy_data(a, vector<float>{1 * scale, 2 * scale, 3 * scale, 4 * scale});
+        copy_data(b, vector<float>{1, 1, 1, 1});
+        handle->call_with_validate({result}, {a, b});
+        auto expected = vector<float>{(1 * scale + 1) * (1 * scale + 1),
+                                      (2 * scale + 1) * (2 * scale + 1),
+                                      (3 * scale + 1) * (3 * scale + 1),
+                                      (4 * scale + 1) * (4 * scale + 1)};
+        EXPECT_TRUE(test::all_close_f(expected, read_vector<float>(result)));
+    }
+
+    // The intermediate pool is owned by the shared buffer sets, not by the context
+    auto usage = cpu_handle->get_memory_usage();
+    ASSERT_EQ(usage.context_bytes.size(), 1);
+    EXPECT_EQ(usage.context_bytes[0], 0);
+    EXPECT_GT(usage.shared_bytes, 0);
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, cpu_test_context_memory_counts_dnnl_primitives)
+{
+    Shape shape_a{1, 16, 8, 8};
+    Shape shape_b{32, 16, 3, 3};
+    auto A = make_shared<op::v0::Parameter>(element::f32, shape_a);
+    auto B = make_shared<op::v0::Parameter>(element::f32, shape_b);
+    auto conv = make_shared<op::v0::Convolution>(A,
+                                                 B,
+                                                 Strides{1, 1},
+                                                 Strides{1, 1},
+                                                 CoordinateDiff{1, 1},
+                                                 CoordinateDiff{1, 1},
+                                                 Strides{1, 1});
+    auto f = make_shared<Function>(conv, ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto a = backend->create_tensor(element::f32, shape_a);
+    auto b = backend->create_tensor(element::f32, shape_b);
+    auto result = backend->create_tensor(element::f32, conv->get_output_shape(0));
+    copy_data(a, vector<float>(shape_size(shape_a), 1.0f));
+    copy_data(b, vector<float>(shape_size(shape_b), 1.0f));
+
+    auto handle = backend->compile(f);
+    auto cpu_handle = dynamic_pointer_cast<runtime::cpu::CPU_Executable>(handle);
+    auto before = cpu_handle->get_memory_usage();
+    ASSERT_EQ(before.context_bytes.size(), 1);
+
+    // The context builds its convolution primitive on the first call
+    handle->call_with_validate({result}, {a, b});
+    auto after = cpu_handle->get_memory_usage();
+    ASSERT_EQ(after.context_bytes.size(), 1);
+    EXPECT_GT(after.context_bytes[0], before.context_bytes[0]);
+
+    // Later calls reuse the primitive
+    handle->call_with_validate({result}, {a, b});
+    EXPECT_EQ(cpu_handle->get_memory_usage().context_bytes[0], after.context_bytes[0]);
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, cpu_test_concurrent_calls)
+{
+    Shape shape{4};
+    auto A = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto B = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(make_shared<op::v1::Multiply>(A, B), ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto handle = backend->compile(f);
+
+    // More callers than contexts, so some of them have to wait for a context to be released
+    const size_t num_threads = 4;
+    // char rather than bool so that every thread writes a byte of its own
+    vector<char> passed(num_threads, false);
+    vector<thread> threads;
+    for (size_t t = 0; t < num_threads; t++)
+    {
+        threads.emplace_back([&, t]() {
+            auto a = backend->create_tensor(element::f32, shape);
+            auto b = backend->create_tensor(element::f32, shape);
+            auto result = backend->create_tensor(element::f32, shape);
+            bool ok = true;
+            for (size_t i = 0; i < 20; i++)
+            {
+                float x = static_cast<float>(t * 100 + i);
+                copy_data(a, vector<float>{x, x, x, x});
+                copy_data(b, vector<float>{1, 2, 3, 4});
+                handle->call_with_validate({result}, {a, b});
+                ok = ok && read_vector<float>(result) == (vector<float>{x, 2 * x, 3 * x, 4 * x});
+            }
+            passed[t] = ok;
+        });
+    }
+    for (auto& t : threads)
+    {
+        t.join();
+    }
+    for (size_t t = 0; t < num_threads; t++)
+    {
+        EXPECT_TRUE(passed[t]);
+    }
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, cpu_test_concurrent_calls_shared_input)
+{
+    if (thread::hardware_concurrency() < 2)
+    {
+        return;
+    }
+    test::EnvironmentGuard environment_guard("NGRAPH_CPU_CONCURRENCY", "2");
+
+    // A + B is cached across calls while A and B are not stale
+    Shape shape{4};
+    auto A = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto B = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto C = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(make_shared<op::v1::Multiply>(make_shared<op::v1::Add>(A, B), C),
+                                   ParameterVector{A, B, C});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto handle = backend->compile(f);
+    auto a = backend->create_tensor(element::f32, shape);
+    auto b = backend->create_tensor(element::f32, shape);
+    auto c = backend->create_tensor(element::f32, shape);
+    copy_data(b, vector<float>{1, 1, 1, 1});
+    copy_data(c, vector<float>{1, 2, 3, 4});
+
+    // The worker computes with A = 1, then the main thread writes A = 2 and computes, possibly
+    // on the other context. When the worker calls again with A and B marked unchanged, its
+    // context must not reuse the A + B it computed before the write.
+    promise<void> first_call;
+    promise<void> second_call;
+    vector<float> first_result;
+    vector<float> third_result;
+    thread worker([&]() {
+        auto result = backend->create_tensor(element::f32, shape);
+        copy_data(a, vector<float>{1, 1, 1, 1});
+        handle->call_with_validate({result}, {a, b, c});
+        first_result = read_vector<float>(result);
+        first_call.set_value();
+        second_call.get_future().wait();
+
+        a->set_stale(false);
+        b->set_stale(false);
+        handle->call_with_validate({result}, {a, b, c});
+        third_result = read_vector<float>(result);
+    });
+
+    first_call.get_future().wait();
+    auto result = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{2, 2, 2, 2});
+    a->set_stale(true);
+    handle->call_with_validate({result}, {a, b, c});
+    EXPECT_TRUE(test::all_close_f(read_vector<float>(result), vector<float>{3, 6, 9, 12}));
+    second_call.set_value();
+    worker.join();
+
+    EXPECT_TRUE(test::all_close_f(first_result, vector<float>{2, 4, 6, 8}));
+    EXPECT_TRUE(test::all_close_f(third_result, vector<float>{3, 6, 9, 12}));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, cpu_test_op_stats_concurrent_calls)
+{
+    set_environment("NGRAPH_CPU_CONCURRENCY", "2", 1);
+    Shape shape{4};
+    auto A = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto B = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto sum = make_shared<op::v1::Add>(A, B);
+    auto f = make_shared<Function>(make_shared<op::v1::Multiply>(sum, B), ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto handle = backend->compile(f);
+    auto cpu_handle = dynamic_pointer_cast<runtime::cpu::CPU_Executable>(handle);
+    ASSERT_NE(cpu_handle, nullptr);
+
+    // Both contexts count their calls, and the counters are read while they run
+    const size_t num_threads = 4;
+    const size_t num_calls = 50;
+    vector<thread> threads;
+    for (size_t t = 0; t < num_threads; t++)
+    {
+        threads.emplace_back([&]() {
+            auto a = backend->create_tensor(element::f32, shape);
+            auto b = backend->create_tensor(element::f32, shape);
+            auto result = backend->create_tensor(element::f32, shape);
+            for (size_t i = 0; i < num_calls; i++)
+            {
+                copy_data(a, vector<float>{1, 2, 3, 4});
+                copy_data(b, vector<float>{1, 1, 1, 1});
+                handle->call_with_validate({result}, {a, b});
+                cpu_handle->get_performance_data();
+            }
+        });
+    }
+    for (auto& t : threads)
+    {
+        t.join();
+    }
+
+    auto stats = cpu_handle->get_op_stats();
+    auto counters = handle->get_performance_data();
+    ASSERT_EQ(stats.size(), counters.size());
+    for (size_t i = 0; i < stats.size(); i++)
+    {
+        EXPECT_EQ(stats[i].m_call_count, num_threads * num_calls);
+        EXPECT_EQ(counters[i].call_count(), num_threads * num_calls);
+        EXPECT_EQ(stats[i].m_node, counters[i].get_node());
+        EXPECT_LE(stats[i].m_latency.get_count(), stats[i].m_call_count);
+        EXPECT_LE(stats[i].m_latency.get_percentile(0.5), stats[i].m_latency.get_percentile(0.99));
+    }
+
+    cpu_handle->reset_op_stats();
+    for (const auto& op_stats : cpu_handle->get_op_stats())
+    {
+        EXPECT_EQ(op_stats.m_call_count, 0);
+        EXPECT_EQ(op_stats.m_latency.get_count(), 0);
+    }
+    unset_environment("NGRAPH_CPU_CONCURRENCY");
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, cpu_test_structural_compile_cache)
+{
+    Shape shape{2, 2};
+    auto make_function = [&shape]() {
+        auto A = make_shared<op::v0::Parameter>(element::f32, shape);
+        auto B = make_shared<op::v0::Parameter>(element::f32, shape);
+        auto sum = make_shared<op::v1::Add>(A, B);
+        return make_shared<Function>(make_shared<op::v1::Multiply>(sum, A),
+                                     ParameterVector{A, B});
+    };
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto handle = backend->compile(make_function());
+    // A rebuilt copy of the same graph reuses the executable instead of recompiling
+    auto f = make_function();
+    EXPECT_EQ(handle, backend->compile(f));
+
+    auto a = backend->create_tensor(element::f32, shape);
+    auto b = backend->create_tensor(element::f32, shape);
+    auto result = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{1, 2, 3, 4});
+    copy_data(b, vector<float>{5, 6, 7, 8});
+    backend->compile(f)->call_with_validate({result}, {a, b});
+    EXPECT_TRUE(test::all_close_f((vector<float>{6, 16, 30, 48}), read_vector<float>(result)));
+
+    // Pass configuration is part of the key
+    pass::PassConfig pass_config;
+    pass_config.set_pass_attribute("CPUMemoryAssignment::ReuseMemory", true);
+    EXPECT_NE(handle, backend->compile(make_function(), pass_config));
+
+    backend->remove_compiled_function(handle);
+    EXPECT_NE(handle, backend->compile(make_function()));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, cpu_test_disk_compile_cache)
+{
+    // A fresh name next to a unique temporary file, so concurrent test runs do not share it
+    string cache_file = file_util::tmp_filename();
+    string cache_dir = cache_file + "_cache";
+    file_util::remove_file(cache_file);
+    test::EnvironmentGuard environment_guard("NGRAPH_CPU_CACHE_DIR", cache_dir);
+
+    Shape shape{2, 2};
+    // (A + B) * A, or (A + B) * B with the same signature
+    auto make_function = [&shape](bool multiply_by_b) {
+        auto A = make_shared<op::v0::Parameter>(element::f32, shape);
+        auto B = make_shared<op::v0::Parameter>(element::f32, shape);
+        auto sum = make_shared<op::v1::Add>(A, B);
+        return make_shared<Function>(
+            make_shared<op::v1::Multiply>(sum, multiply_by_b ? B : A), ParameterVector{A, B});
+    };
+    auto cache_files = [&cache_dir]() {
+        set<string> files;
+        file_util::iterate_files(cache_dir,
+                                 [&files](const string& file, bool is_dir) {
+                                     if (!is_dir && file_util::get_file_ext(file) == ".ngcpu")
+                                     {
+                                         files.insert(file);
+                                     }
+                                 },
+                                 false);
+        return files;
+    };
+    auto read_file = [](const string& path) {
+        ifstream in(path, ios_base::binary);
+        return string(istreambuf_iterator<char>(in), istreambuf_iterator<char>());
+    };
+    auto write_file = [](const string& path, const string& contents) {
+        ofstream out(path, ios_base::binary | ios_base::trunc);
+        out << contents;
+    };
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto a = backend->create_tensor(element::f32, shape);
+    auto b = backend->create_tensor(element::f32, shape);
+    auto result = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{1, 2, 3, 4});
+    copy_data(b, vector<float>{5, 6, 7, 8});
+
+    auto handle = backend->compile(make_function(false));
+    set<string> files = cache_files();
+    ASSERT_EQ(files.size(), 1);
+    string file_a = *files.begin();
+    string contents_a = read_file(file_a);
+    auto handle_b = backend->compile(make_function(true));
+    files = cache_files();
+    ASSERT_EQ(files.size(), 2);
+    files.erase(file_a);
+    string contents_b = read_file(*files.begin());
+
+    // Give the file of (A + B) * A the executable of (A + B) * B under the key of the former.
+    // Only an executable that was really read from the file multiplies by B.
+    string key_line_a = contents_a.substr(0, contents_a.find('\n') + 1);
+    string body_b = contents_b.substr(contents_b.find('\n') + 1);
+    write_file(file_a, key_line_a + body_b);
+    backend->remove_compiled_function(handle);
+    auto loaded = backend->compile(make_function(false));
+    EXPECT_NE(loaded, handle);
+    loaded->call_with_validate({result}, {a, b});
+    EXPECT_TRUE(test::all_close_f((vector<float>{30, 48, 70, 96}), read_vector<float>(result)));
+
+    // A file that cannot be read is ignored and the function is compiled again
+    write_file(file_a, key_line_a + "not an executable");
+    backend->remove_compiled_function(loaded);
+    auto recompiled = backend->compile(make_function(false));
+    recompiled->call_with_validate({result}, {a, b});
+    EXPECT_TRUE(test::all_close_f((vector<float>{6, 16, 30, 48}), read_vector<float>(result)));
+    // and the compiled executable is written over it
+    string rewritten = read_file(file_a);
+    EXPECT_EQ(rewritten.substr(0, key_line_a.size()), key_line_a);
+    EXPECT_NE(rewritten, key_line_a + "not an executable");
+
+    file_util::remove_directory(cache_dir);
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, cpu_test_save_load)
+{
+    auto make_function = []() -> std::shared_ptr<Function> {
+        auto A = make_shared<op::v0::Parameter>(element::f32, Shape{1, 16, 4, 4});
+        auto B = make_shared<op::v0::Parameter>(element::f32, Shape{32, 16, 1, 1});
+        auto conv = make_shared<op::v0::Convolution>(A,
+                                                     B,
+                                                     Strides{1, 1},
+                                                     Strides{1, 1},
+                                                     CoordinateDiff{0, 0},
+                                                     CoordinateDiff{0, 0},
+                                                     Strides{1, 1});
+        auto relu = make_shared<op::v0::Relu>(conv);
+        return make_shared<Function>(OutputVector{relu}, ParameterVector{A, B});
+    };
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto cpu_f = make_function();
+    auto handle = backend->compile(cpu_f);
+    stringstream saved;
+    handle->save(saved);
+    auto loaded = backend->load(saved);
+    ASSERT_NE(loaded, nullptr);
+    EXPECT_NE(loaded, handle);
+
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<shared_ptr<runtime::Tensor>> args;
+    for (auto& param : cpu_f->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_output_shape(0)));
+        rng.initialize(tensor_val);
+        auto tensor = backend->create_tensor(element::f32, param->get_output_shape(0));
+        copy_data(tensor, tensor_val);
+        args.push_back(tensor);
+    }
+    auto expected = backend->create_tensor(element::f32, Shape{1, 32, 4, 4});
+    auto result = backend->create_tensor(element::f32, Shape{1, 32, 4, 4});
+    handle->call_with_validate({expected}, args);
+    loaded->call_with_validate({result}, args);
+    EXPECT_EQ(read_vector<float>(expected), read_vector<float>(result));
+}
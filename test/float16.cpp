@@ -15,6 +15,7 @@
 //*****************************************************************************
 
 #include <climits>
+#include <cstring>
 #include <random>
 
 #include "gtest/gtest.h"
@@ -119,3 +120,38 @@ TEST(float16, values)
     EXPECT_EQ(static_cast<float16>(65519.0).to_bits(), 0x7bff);
     EXPECT_EQ(static_cast<float16>(65520.0).to_bits(), 0x7c00);
 }
+
+TEST(float16, array_conversions)
+{
+    // Every float16 value, including denormals, infinities and NaNs
+    vector<float16> halves(65536);
+    for (size_t i = 0; i < halves.size(); ++i)
+    {
+        halves[i] = float16::from_bits(static_cast<uint16_t>(i));
+    }
+    vector<float> floats(halves.size());
+    float16::to_float(halves.data(), floats.data(), halves.size());
+    vector<float16> round_trip(halves.size());
+    float16::from_float(floats.data(), round_trip.data(), floats.size());
+    for (size_t i = 0; i < halves.size(); ++i)
+    {
+        float expected = static_cast<float>(halves[i]);
+        EXPECT_EQ(0, memcmp(&expected, &floats[i], sizeof(float)));
+        EXPECT_EQ(float16(floats[i]).to_bits(), round_trip[i].to_bits());
+    }
+
+    // Values that need rounding
+    std::mt19937 rng(2112);
+    std::uniform_real_distribution<float> distribution(-70000, 70000);
+    vector<float> values(4096);
+    for (float& value : values)
+    {
+        value = distribution(rng) / (1 << (rng() % 32));
+    }
+    vector<float16> converted(values.size());
+    float16::from_float(values.data(), converted.data(), values.size());
+    for (size_t i = 0; i < values.size(); ++i)
+    {
+        EXPECT_EQ(float16(values[i]).to_bits(), converted[i].to_bits());
+    }
+}
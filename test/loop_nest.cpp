@@ -0,0 +1,87 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/reference/loop_nest.hpp"
+
+using namespace std;
+using namespace ngraph;
+using namespace ngraph::runtime::reference;
+
+TEST(loop_nest, broadcast_strides)
+{
+    EXPECT_EQ(broadcast_strides(Shape{3, 1, 2}, 4), (Strides{0, 2, 0, 1}));
+    EXPECT_EQ(broadcast_strides(Shape{}, 2), (Strides{0, 0}));
+}
+
+TEST(loop_nest, reduction_strides)
+{
+    EXPECT_EQ(reduction_strides(Shape{2, 3, 4}, AxisSet{1}), (Strides{4, 0, 1}));
+    EXPECT_EQ(reduction_strides(Shape{2, 3, 4}, AxisSet{0, 2}), (Strides{0, 1, 0}));
+}
+
+TEST(loop_nest, merges_contiguous_axes)
+{
+    Shape shape{2, 1, 3, 4};
+    LoopNest<1> contiguous(shape, {row_major_strides(shape)});
+    EXPECT_EQ(contiguous.get_rank(), 1);
+
+    // The reduced middle axis splits the nest in three
+    LoopNest<2> reduction(shape, {row_major_strides(shape), reduction_strides(shape, {2})});
+    EXPECT_EQ(reduction.get_rank(), 3);
+
+    LoopNest<1> scalar(Shape{}, {Strides{}});
+    EXPECT_EQ(scalar.get_rank(), 0);
+}
+
+TEST(loop_nest, matches_coordinate_transform)
+{
+    // Walk a transposed, partially broadcast view of rank five so the generic path is used
+    Shape shape{2, 3, 2, 4, 3};
+    Strides transposed{1, 2, 6, 12, 48};
+    Strides broadcast = broadcast_strides(Shape{3, 1, 4, 1}, shape.size());
+    LoopNest<2> loops(shape, {transposed, broadcast});
+    EXPECT_EQ(loops.get_rank(), 5);
+
+    vector<LoopNest<2>::Offsets> expected;
+    CoordinateTransform transform(shape);
+    for (const Coordinate& coord : transform)
+    {
+        LoopNest<2>::Offsets offsets{};
+        for (size_t i = 0; i < shape.size(); ++i)
+        {
+            offsets[0] += coord[i] * transposed[i];
+            offsets[1] += coord[i] * broadcast[i];
+        }
+        expected.push_back(offsets);
+    }
+
+    vector<LoopNest<2>::Offsets> visited;
+    loops.for_each([&](const LoopNest<2>::Offsets& offsets) { visited.push_back(offsets); });
+    EXPECT_EQ(visited, expected);
+}
+
+TEST(loop_nest, empty_shape)
+{
+    size_t count = 0;
+    LoopNest<1> loops(Shape{3, 0, 2}, {Strides{0, 2, 1}});
+    loops.for_each([&](const LoopNest<1>::Offsets&) { count++; });
+    EXPECT_EQ(count, 0);
+}
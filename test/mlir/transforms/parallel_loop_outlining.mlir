@@ -0,0 +1,59 @@
+// RUN: ngraph-opt %s -ngraph-parallel-loop-outlining -split-input-file | FileCheck %s
+
+// Iterations of the outer loop write different rows, so it is outlined
+// CHECK: func @callback_parallel_for(i64, i64, i64, i64, i64, i64)
+// CHECK-LABEL: func @main
+// CHECK-NEXT: %[[ID:.*]] = constant 0 : i64
+// CHECK-NEXT: %[[LB:.*]] = constant 0 : i64
+// CHECK-NEXT: %[[UB:.*]] = constant 16 : i64
+// CHECK-NEXT: %[[STEP:.*]] = constant 1 : i64
+// CHECK-NEXT: %[[GRAIN:.*]] = constant 1 : i64
+// CHECK-NEXT: %[[COST:.*]] = constant 24 : i64
+// CHECK-NEXT: call @callback_parallel_for(%[[ID]], %[[LB]], %[[UB]], %[[STEP]], %[[GRAIN]], %[[COST]])
+// CHECK-NEXT: return
+// CHECK: func @__ngraph_parallel_body_0(%[[BEGIN:.*]]: index, %[[END:.*]]: index, %[[A:.*]]: memref<16x8xf32>, %[[B:.*]]: memref<16x8xf32>)
+// CHECK-NEXT: affine.for %[[I:.*]] = %[[BEGIN]] to %[[END]] {
+// CHECK-NEXT: affine.for %[[J:.*]] = 0 to 8 {
+// CHECK-NEXT: %[[X:.*]] = affine.load %[[A]][%[[I]], %[[J]]]
+// CHECK-NEXT: %[[Y:.*]] = addf %[[X]], %[[X]]
+// CHECK-NEXT: affine.store %[[Y]], %[[B]][%[[I]], %[[J]]]
+func @main(%arg0: memref<16x8xf32>, %arg1: memref<16x8xf32>) {
+  affine.for %i = 0 to 16 {
+    affine.for %j = 0 to 8 {
+      %0 = affine.load %arg0[%i, %j] : memref<16x8xf32>
+      %1 = addf %0, %0 : f32
+      affine.store %1, %arg1[%i, %j] : memref<16x8xf32>
+    }
+  }
+  return
+}
+
+// -----
+
+// Each iteration reads what the previous one wrote, so the loop stays
+// CHECK-LABEL: func @main
+// CHECK-NEXT: affine.for
+// CHECK-NOT: callback_parallel_for
+func @main(%arg0: memref<16xf32>) {
+  affine.for %i = 1 to 16 {
+    %0 = affine.load %arg0[%i - 1] : memref<16xf32>
+    affine.store %0, %arg0[%i] : memref<16xf32>
+  }
+  return
+}
+
+// -----
+
+// Temporaries of the entry function cannot be passed to an outlined loop
+// CHECK-LABEL: func @main
+// CHECK: affine.for
+// CHECK-NOT: callback_parallel_for
+func @main(%arg0: memref<16xf32>) {
+  %0 = alloc() : memref<16xf32>
+  affine.for %i = 0 to 16 {
+    %1 = affine.load %arg0[%i] : memref<16xf32>
+    affine.store %1, %0[%i] : memref<16xf32>
+  }
+  dealloc %0 : memref<16xf32>
+  return
+}
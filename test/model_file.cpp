@@ -0,0 +1,96 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <memory>
+#include <sstream>
+
+#include <gtest/gtest.h>
+
+#include "ngraph/check.hpp"
+#include "ngraph/file_util.hpp"
+#include "ngraph/model_file.hpp"
+
+using namespace ngraph;
+using namespace std;
+
+TEST(model_file, write_read)
+{
+    const string test_file = "test1.ngmf";
+    string s1 = "this is a test";
+    string s2 = "the quick brown fox jumps over the lazy dog";
+    {
+        model_file::Writer writer(test_file);
+        writer.write("file1.txt", s1.data(), s1.size());
+        writer.write("file.txt", s2.data(), s2.size());
+    }
+    EXPECT_TRUE(model_file::is_model_file(test_file));
+
+    shared_ptr<runtime::AlignedBuffer> data;
+    {
+        model_file::Reader reader(test_file);
+        ASSERT_EQ(reader.get_entry_count(), 2);
+        EXPECT_EQ(reader.get_name(0), "file1.txt");
+        EXPECT_EQ(reader.get_name(1), "file.txt");
+        EXPECT_EQ(reader.find("file.txt"), 1);
+        EXPECT_EQ(reader.find("missing.txt"), reader.get_entry_count());
+        EXPECT_EQ(string(reader.get_data(0), reader.get_size(0)), s1);
+        data = reader.get_buffer(1);
+    }
+    // The buffer keeps the mapping alive after the reader is gone
+    ASSERT_EQ(data->size(), s2.size());
+    EXPECT_EQ(size_t(data->get_ptr()) % model_file::alignment, 0);
+    EXPECT_EQ(string(data->get_ptr<char>(), data->size()), s2);
+
+    // Writes to the mapping stay out of the file
+    data->get_ptr<char>()[0] = 'T';
+    data.reset();
+    {
+        ifstream in(test_file, ios_base::binary | ios_base::in);
+        model_file::Reader reader(in);
+        ASSERT_EQ(reader.get_entry_count(), 2);
+        EXPECT_EQ(string(reader.get_data(1), reader.get_size(1)), s2);
+    }
+    file_util::remove_file(test_file);
+}
+
+TEST(model_file, invalid)
+{
+    stringstream json("[{\"name\":\"Function_0\"}]");
+    EXPECT_FALSE(model_file::is_model_file(json));
+    EXPECT_EQ(json.tellg(), 0);
+
+    stringstream truncated("NGRAPHMF");
+    EXPECT_TRUE(model_file::is_model_file(truncated));
+    EXPECT_ANY_THROW(model_file::Reader reader(truncated));
+}
+
+TEST(model_file, invalid_entry_count)
+{
+    stringstream file;
+    {
+        model_file::Writer writer(file);
+        string s = "this is a test";
+        writer.write("file.txt", s.data(), s.size());
+    }
+    // The entry count is the last 8 bytes of the trailer
+    string bytes = file.str();
+    for (size_t i = bytes.size() - 8; i < bytes.size(); ++i)
+    {
+        bytes[i] = '\xff';
+    }
+    stringstream corrupt(bytes);
+    EXPECT_THROW(model_file::Reader reader(corrupt), CheckFailure);
+}
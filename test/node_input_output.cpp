@@ -111,3 +111,32 @@ TEST(node_input_output, output_create_const)
 
     EXPECT_THROW(add->output(1), std::out_of_range);
 }
+
+TEST(node_input_output, grow_connected)
+{
+    auto x = make_shared<op::v0::Parameter>(element::f32, Shape{1, 2, 3, 4});
+    auto y = make_shared<op::v0::Parameter>(element::f32, Shape{1, 2, 3, 4});
+    auto add = make_shared<op::v1::Add>(x, y);
+    auto neg = make_shared<op::v0::Negative>(add);
+
+    // Connections survive the inputs and outputs of a connected node being reallocated
+    add->set_output_size(8);
+    for (size_t i = 2; i < 8; ++i)
+    {
+        add->set_argument(i, x);
+    }
+
+    EXPECT_EQ(neg->input_value(0), add->output(0));
+    auto add_targets = add->output(0).get_target_inputs();
+    ASSERT_EQ(add_targets.size(), 1);
+    EXPECT_EQ(add_targets.begin()->get_node(), neg.get());
+
+    EXPECT_EQ(add->input_value(1), y->output(0));
+    auto x_targets = x->output(0).get_target_inputs();
+    EXPECT_EQ(x_targets.size(), 7);
+    for (auto& input : x_targets)
+    {
+        EXPECT_EQ(input.get_node(), add.get());
+        EXPECT_EQ(input.get_source_output(), x->output(0));
+    }
+}
@@ -425,6 +425,34 @@ NGRAPH_TEST(${BACKEND_NAME}, onnx_model_initializer_wo_input)
     test_case.run();
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, onnx_model_external_data)
+{
+    // W and B are stored in tensors.bin next to the model, B at an offset that is not aligned
+    auto function = onnx_import::import_onnx_model(
+        file_util::path_join(SERIALIZED_ZOO, "onnx/external_data/external_data.prototxt"));
+
+    auto test_case = ngraph::test::NgraphTestCase(function, "${BACKEND_NAME}");
+    test_case.add_input<float>({0, 1, 2, 3, 4, 5});
+    test_case.add_expected_output<float>({10, 22, 36, 52, 70, 90});
+    test_case.run();
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, onnx_model_external_data_outside_model_dir)
+{
+    EXPECT_THROW(onnx_import::import_onnx_model(file_util::path_join(
+                     SERIALIZED_ZOO, "onnx/external_data/external_data_outside_dir.prototxt")),
+                 ngraph_error)
+        << "External data locations may not leave the model's directory.";
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, onnx_model_external_data_bad_offset)
+{
+    EXPECT_THROW(onnx_import::import_onnx_model(file_util::path_join(
+                     SERIALIZED_ZOO, "onnx/external_data/external_data_bad_offset.prototxt")),
+                 ngraph_error)
+        << "An offset that is not a number is rejected.";
+}
+
 // ############################################################################ OPERATOR TESTS
 NGRAPH_TEST(${BACKEND_NAME}, onnx_model_addmul_abc)
 {
@@ -14,6 +14,7 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <limits>
 #include <memory>
 #include <sstream>
 #include <string>
@@ -35,7 +36,8 @@ using namespace std;
 static vector<pass::MemoryManager::node> get_node_list(const pass::MemoryManager& mm)
 {
     vector<pass::MemoryManager::node> rc;
-    rc.insert(rc.end(), mm.begin(), mm.end());
+    auto blocks = mm.get_node_list();
+    rc.insert(rc.end(), blocks.begin(), blocks.end());
     return rc;
 }
 
@@ -203,6 +205,63 @@ TEST(memory_manager, memory_align)
     EXPECT_EQ(128, mm.allocate(4));
 }
 
+TEST(memory_manager, best_fit)
+{
+    pass::MemoryManager mm{1, pass::MemoryManager::allocation_scheme::BEST_FIT};
+
+    EXPECT_EQ(0, mm.allocate(10));
+    EXPECT_EQ(10, mm.allocate(10));
+    EXPECT_EQ(20, mm.allocate(5));
+    EXPECT_EQ(25, mm.allocate(10));
+    mm.free(0);
+    mm.free(20);
+
+    // The 5 byte hole is a better fit than the 10 byte hole in front of it
+    EXPECT_EQ(20, mm.allocate(5));
+    EXPECT_EQ(0, mm.allocate(8));
+    EXPECT_EQ(8, mm.allocate(2));
+    EXPECT_EQ(35, mm.allocate(1));
+}
+
+TEST(memory_manager, free_into_tail)
+{
+    pass::MemoryManager mm{1};
+
+    EXPECT_EQ(0, mm.allocate(10));
+    EXPECT_EQ(10, mm.allocate(10));
+    mm.free(10);
+    mm.free(0);
+
+    auto node_list = get_node_list(mm);
+    EXPECT_EQ(1, node_list.size());
+    EXPECT_TRUE(node_list[0].is_free());
+    EXPECT_EQ(numeric_limits<size_t>::max(), node_list[0].m_size);
+    EXPECT_EQ(0, mm.allocate(100));
+    EXPECT_EQ(100, mm.max_allocated());
+}
+
+TEST(memory_manager, first_fit_many)
+{
+    pass::MemoryManager mm{8};
+
+    // Allocate a run of blocks, free every other one, then refill the holes in order
+    const size_t count = 10000;
+    for (size_t i = 0; i < count; ++i)
+    {
+        EXPECT_EQ(i * 16, mm.allocate(i % 2 == 0 ? 16 : 9));
+    }
+    for (size_t i = 0; i < count; i += 2)
+    {
+        mm.free(i * 16);
+    }
+    EXPECT_EQ(count + 1, mm.get_node_list().size());
+    for (size_t i = 0; i < count; i += 2)
+    {
+        EXPECT_EQ(i * 16, mm.allocate(16));
+    }
+    EXPECT_EQ(count * 16, mm.allocate(1));
+}
+
 TEST(memory_layout, basic)
 {
     pass::Manager pass_manager;
@@ -231,3 +290,32 @@ TEST(memory_layout, constant)
     size_t temporary_pool_size = f->get_temporary_pool_size();
     EXPECT_EQ(4, temporary_pool_size);
 }
+
+static size_t get_temporary_pool_size(shared_ptr<Function> f, bool greedy_by_size)
+{
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::Liveness>();
+    pass_manager.register_pass<pass::MemoryLayout>(1, false, greedy_by_size);
+    pass_manager.run_passes(f);
+    return f->get_temporary_pool_size();
+}
+
+TEST(memory_layout, greedy_by_size)
+{
+    EXPECT_EQ(12, get_temporary_pool_size(make_test_graph(), true));
+
+    auto make_function = []() {
+        auto A = make_shared<op::v0::Parameter>(element::f32, Shape{64});
+        auto B = make_shared<op::v0::Slice>(A, Coordinate{0}, Coordinate{57});
+        auto C = make_shared<op::v0::Concat>(OutputVector{A, B}, 0);
+        auto D = make_shared<op::v0::Negative>(make_shared<op::v0::Concat>(OutputVector{B, B}, 0));
+        auto E = make_shared<op::v0::Slice>(B, Coordinate{0}, Coordinate{48});
+        auto sum = make_shared<op::v1::Add>(make_shared<op::v0::Sum>(C, AxisSet{0}),
+                                            make_shared<op::v0::Sum>(D, AxisSet{0}));
+        return make_shared<Function>(
+            make_shared<op::v1::Add>(sum, make_shared<op::v0::Sum>(E, AxisSet{0})),
+            ParameterVector{A});
+    };
+    EXPECT_EQ(1172, get_temporary_pool_size(make_function(), false));
+    EXPECT_EQ(1144, get_temporary_pool_size(make_function(), true));
+}
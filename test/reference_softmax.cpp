@@ -0,0 +1,81 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "ngraph/runtime/reference/log_softmax.hpp"
+#include "ngraph/runtime/reference/softmax.hpp"
+
+using namespace std;
+using namespace ngraph;
+using namespace ngraph::runtime::reference;
+
+// The ONNX importer computes LogSoftmax as Log(Softmax(x)), which the kernel has to match
+static void check_log_softmax(const Shape& shape, const AxisSet& axes)
+{
+    vector<float> arg(shape_size(shape));
+    default_random_engine engine(0);
+    uniform_real_distribution<float> distribution(-5, 5);
+    for (float& x : arg)
+    {
+        x = distribution(engine);
+    }
+    vector<float> expected(arg.size());
+    softmax(arg.data(), expected.data(), shape, axes);
+    for (float& x : expected)
+    {
+        x = std::log(x);
+    }
+    vector<float> result(arg.size());
+    log_softmax(arg.data(), result.data(), shape, axes);
+    for (size_t i = 0; i < arg.size(); i++)
+    {
+        EXPECT_NEAR(result[i], expected[i], 1e-5f) << "at " << i;
+    }
+}
+
+TEST(reference_softmax, log_softmax_innermost_axis)
+{
+    check_log_softmax(Shape{4, 37}, AxisSet{1});
+}
+
+TEST(reference_softmax, log_softmax_outer_axis)
+{
+    check_log_softmax(Shape{5, 3, 7}, AxisSet{0});
+}
+
+TEST(reference_softmax, log_softmax_multiple_axes)
+{
+    check_log_softmax(Shape{3, 4, 5}, AxisSet{0, 2});
+    check_log_softmax(Shape{3, 4, 5}, AxisSet{1, 2});
+}
+
+TEST(reference_softmax, log_softmax_large_range)
+{
+    // exp(-200) underflows in float, so Log(Softmax(x)) would give -inf for the first element
+    vector<float> arg{-100, 100, 99};
+    vector<float> result(arg.size());
+    log_softmax(arg.data(), result.data(), Shape{3}, AxisSet{0});
+    double log_sum = std::log(std::exp(-200.0) + 1 + std::exp(-1.0));
+    EXPECT_NEAR(result[0], -200 - log_sum, 1e-4);
+    EXPECT_NEAR(result[1], -log_sum, 1e-6);
+    EXPECT_NEAR(result[2], -1 - log_sum, 1e-6);
+}
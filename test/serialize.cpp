@@ -192,6 +192,99 @@ TEST(serialize, constant)
     EXPECT_TRUE(found);
 }
 
+TEST(serialize, constant_model_file)
+{
+    const string tmp_file = "serialize_constant.ngmf";
+    auto A = op::v0::Constant::create(element::f32, Shape{2, 2}, {1, 2, 3, 4});
+    auto B = op::v0::Constant::create(element::i64, Shape{3}, {7, 7, 7});
+    auto sum = make_shared<op::v1::Add>(A, A);
+    auto g = make_shared<Function>(OutputVector{sum, B}, ParameterVector{});
+
+    serialize_model_file(tmp_file, g);
+    for (bool mapped : {true, false})
+    {
+        shared_ptr<Function> h;
+        if (mapped)
+        {
+            h = deserialize(tmp_file);
+        }
+        else
+        {
+            ifstream in(tmp_file, ios_base::binary | ios_base::in);
+            h = deserialize(in);
+        }
+        ASSERT_NE(h, nullptr);
+        vector<shared_ptr<op::v0::Constant>> constants;
+        for (shared_ptr<Node> node : h->get_ordered_ops())
+        {
+            if (auto c = as_type_ptr<op::v0::Constant>(node))
+            {
+                constants.push_back(c);
+            }
+        }
+        ASSERT_EQ(constants.size(), 2);
+        for (auto c : constants)
+        {
+            if (c->get_output_element_type(0) == element::f32)
+            {
+                EXPECT_EQ(c->get_output_shape(0), (Shape{2, 2}));
+                EXPECT_EQ((vector<float>{1, 2, 3, 4}), c->get_vector<float>());
+            }
+            else
+            {
+                EXPECT_EQ(c->get_output_shape(0), (Shape{3}));
+                EXPECT_EQ((vector<int64_t>{7, 7, 7}), c->get_vector<int64_t>());
+                EXPECT_TRUE(c->get_all_data_elements_bitwise_identical());
+            }
+        }
+    }
+    file_util::remove_file(tmp_file);
+}
+
+TEST(serialize, tensor_iterator_constant_model_file)
+{
+    const string tmp_file = "serialize_tensor_iterator_constant.ngmf";
+    auto X = make_shared<op::v0::Parameter>(element::f32, Shape{4, 3});
+
+    // The body scales each row by a constant of its own
+    auto Xi = make_shared<op::v0::Parameter>(element::f32, Shape{1, 3});
+    auto scale = op::v0::Constant::create(element::f32, Shape{1, 3}, {1, 2, 3});
+    auto Zo = make_shared<op::v1::Multiply>(Xi, scale);
+    auto body =
+        make_shared<op::v0::TensorIterator::BodyLambda>(OutputVector{Zo}, ParameterVector{Xi});
+
+    auto tensor_iterator = make_shared<op::v0::TensorIterator>();
+    tensor_iterator->set_body(body);
+    tensor_iterator->set_sliced_input(Xi, X, 0, 1, 1, -1, 0);
+    auto out = tensor_iterator->get_concatenated_slices(Zo, 0, 1, 1, -1, 0);
+    auto f = make_shared<Function>(OutputVector{out}, ParameterVector{X});
+
+    serialize_model_file(tmp_file, f);
+    auto g = deserialize(tmp_file);
+    file_util::remove_file(tmp_file);
+    ASSERT_NE(g, nullptr);
+
+    shared_ptr<op::v0::TensorIterator> g_tensor_iterator;
+    for (auto& node : g->get_ops())
+    {
+        if (auto ti = as_type_ptr<op::v0::TensorIterator>(node))
+        {
+            g_tensor_iterator = ti;
+        }
+    }
+    ASSERT_NE(g_tensor_iterator, nullptr);
+    shared_ptr<op::v0::Constant> g_scale;
+    for (auto& node : topological_sort(g_tensor_iterator->get_body()->get_results()))
+    {
+        if (auto c = as_type_ptr<op::v0::Constant>(node))
+        {
+            g_scale = c;
+        }
+    }
+    ASSERT_NE(g_scale, nullptr);
+    EXPECT_EQ((vector<float>{1, 2, 3}), g_scale->get_vector<float>());
+}
+
 TEST(benchmark, serialize)
 {
     stopwatch timer;
@@ -0,0 +1,98 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#include "gtest/gtest.h"
+
+#include "ngraph/runtime/task_scheduler.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+TEST(task_scheduler, dependencies)
+{
+    runtime::TaskGraph graph(4);
+    graph.add_dependency(2, 0);
+    graph.add_dependency(2, 1);
+    graph.add_dependency(3, 2);
+    runtime::TaskScheduler scheduler(3);
+    for (size_t run = 0; run < 10; ++run)
+    {
+        atomic<size_t> finished[4];
+        for (auto& f : finished)
+        {
+            f = 0;
+        }
+        atomic<size_t> order{0};
+        scheduler.run(graph, [&](size_t task) { finished[task] = ++order; });
+        EXPECT_LT(finished[0], finished[2]);
+        EXPECT_LT(finished[1], finished[2]);
+        EXPECT_LT(finished[2], finished[3]);
+    }
+}
+
+TEST(task_scheduler, calling_thread_runs_tasks)
+{
+    // Each task waits until the other one has started, which needs two threads while the
+    // scheduler only has one worker
+    runtime::TaskGraph graph(2);
+    runtime::TaskScheduler scheduler(1);
+    mutex m;
+    condition_variable cv;
+    size_t started = 0;
+    atomic<size_t> met{0};
+    thread::id task_thread[2];
+    scheduler.run(graph, [&](size_t task) {
+        task_thread[task] = this_thread::get_id();
+        unique_lock<mutex> lock(m);
+        started++;
+        cv.notify_all();
+        if (cv.wait_for(lock, chrono::seconds(10), [&] { return started == 2; }))
+        {
+            met++;
+        }
+    });
+    EXPECT_EQ(met, 2);
+    EXPECT_NE(task_thread[0], task_thread[1]);
+    EXPECT_TRUE(task_thread[0] == this_thread::get_id() ||
+                task_thread[1] == this_thread::get_id());
+}
+
+TEST(task_scheduler, exception)
+{
+    runtime::TaskGraph graph(3);
+    graph.add_dependency(2, 1);
+    runtime::TaskScheduler scheduler(2);
+    atomic<bool> ran_dependent{false};
+    EXPECT_THROW(scheduler.run(graph,
+                               [&](size_t task) {
+                                   if (task == 1)
+                                   {
+                                       throw runtime_error("task 1");
+                                   }
+                                   if (task == 2)
+                                   {
+                                       ran_dependent = true;
+                                   }
+                               }),
+                 runtime_error);
+    EXPECT_FALSE(ran_dependent);
+}
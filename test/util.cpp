@@ -395,6 +395,57 @@ TEST(graph_util, test_subgraph_topological_sort_control_dependencies)
     ASSERT_EQ(expected, sorted);
 }
 
+TEST(graph_util, structural_hash)
+{
+    auto make_function = [](float scale, op::AutoBroadcastType broadcast) {
+        auto A = make_shared<op::v0::Parameter>(element::f32, Shape{2, 2});
+        auto B = make_shared<op::v0::Parameter>(element::f32, Shape{2, 2});
+        auto k = op::v0::Constant::create(element::f32, Shape{2, 2}, vector<float>{scale, 1, 2, 3});
+        auto add = make_shared<op::v1::Add>(A, B, broadcast);
+        auto mul = make_shared<op::v1::Multiply>(add, k);
+        return make_shared<Function>(mul, ParameterVector{A, B});
+    };
+
+    auto f = make_function(1, op::AutoBroadcastType::NUMPY);
+    string hash = structural_hash(*f);
+    EXPECT_FALSE(hash.empty());
+    // Independently built graphs with different node names hash the same
+    EXPECT_EQ(hash, structural_hash(*make_function(1, op::AutoBroadcastType::NUMPY)));
+    EXPECT_EQ(hash, structural_hash(*clone_function(*f)));
+    // Constant values and attributes are part of the structure
+    EXPECT_NE(hash, structural_hash(*make_function(5, op::AutoBroadcastType::NUMPY)));
+    EXPECT_NE(hash, structural_hash(*make_function(1, op::AutoBroadcastType::NONE)));
+
+    // Flipping the sign bit of two words cancelled out in the old multiplicative hash
+    auto make_constant_function = [](const vector<float>& values) {
+        auto A = make_shared<op::v0::Parameter>(element::f32, Shape{4});
+        auto k = op::v0::Constant::create(element::f32, Shape{4}, values);
+        return make_shared<Function>(make_shared<op::v1::Multiply>(A, k), ParameterVector{A});
+    };
+    EXPECT_NE(structural_hash(*make_constant_function({1, 2, 3, 4})),
+              structural_hash(*make_constant_function({1, -2, 3, -4})));
+    EXPECT_NE(structural_hash(*make_constant_function({1, 2, 3, 4})),
+              structural_hash(*make_constant_function({-1, -2, 3, 4})));
+
+    // Swapping the parameter order changes the function signature
+    auto g = make_function(1, op::AutoBroadcastType::NUMPY);
+    auto params = g->get_parameters();
+    auto swapped = make_shared<Function>(g->get_results(), ParameterVector{params[1], params[0]});
+    EXPECT_NE(hash, structural_hash(*swapped));
+
+    // Ops without an attribute visitor are hashed by their serialized attributes
+    auto make_slice = [](const Coordinate& lower, const Coordinate& upper, const Strides& strides) {
+        auto A = make_shared<op::v0::Parameter>(element::f32, Shape{4});
+        auto slice = make_shared<op::v0::Slice>(A, lower, upper, strides);
+        return make_shared<Function>(OutputVector{slice}, ParameterVector{A});
+    };
+    string slice_hash = structural_hash(*make_slice({0}, {4}, {2}));
+    EXPECT_FALSE(slice_hash.empty());
+    EXPECT_EQ(slice_hash, structural_hash(*make_slice({0}, {4}, {2})));
+    // Same output shape, different bounds
+    EXPECT_NE(slice_hash, structural_hash(*make_slice({1}, {3}, {1})));
+}
+
 TEST(util, enum_mask_construction)
 {
     enum class Type : uint32_t
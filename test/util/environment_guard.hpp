@@ -0,0 +1,66 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstdlib>
+#include <string>
+
+#include "misc.hpp"
+
+namespace ngraph
+{
+    namespace test
+    {
+        /// \brief Set an environment variable for the duration of a unit test.
+        ///
+        /// When it's destroyed the variable gets its previous value back, or is unset if it
+        /// had none, so a failed assertion does not leak it into the tests that follow.
+        class EnvironmentGuard
+        {
+        public:
+            EnvironmentGuard(const std::string& name, const std::string& value)
+                : m_name(name)
+            {
+                const char* saved_value = std::getenv(name.c_str());
+                m_was_set = saved_value != nullptr;
+                if (m_was_set)
+                {
+                    m_saved_value = saved_value;
+                }
+                set_environment(m_name.c_str(), value.c_str(), 1);
+            }
+            ~EnvironmentGuard()
+            {
+                if (m_was_set)
+                {
+                    set_environment(m_name.c_str(), m_saved_value.c_str(), 1);
+                }
+                else
+                {
+                    unset_environment(m_name.c_str());
+                }
+            }
+            EnvironmentGuard(const EnvironmentGuard&) = delete;
+            EnvironmentGuard& operator=(const EnvironmentGuard&) = delete;
+
+        private:
+            std::string m_name;
+            std::string m_saved_value;
+            bool m_was_set;
+        };
+    }
+}